@@ -0,0 +1,67 @@
+#pragma once
+
+// well known generators to compare against, in the same style as the
+// generators in tiptap: next() advances and returns the output.
+
+#include <cstdint>
+
+/// splitmix64 by Sebastiano Vigna, public domain.
+/// https://prng.di.unimi.it/splitmix64.c
+class SplitMix64
+{
+public:
+  explicit SplitMix64(std::uint64_t seed = 0)
+    : m_state(seed)
+  {
+  }
+
+  static constexpr int bits_per_call = 64;
+
+  std::uint64_t next()
+  {
+    std::uint64_t z = (m_state += 0x9e3779b97f4a7c15);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    return z ^ (z >> 31);
+  }
+
+private:
+  std::uint64_t m_state;
+};
+
+/// xoshiro256** 1.0 by David Blackman and Sebastiano Vigna, public domain.
+/// https://prng.di.unimi.it/xoshiro256starstar.c
+/// the state is seeded with splitmix64, as recommended by the authors.
+class Xoshiro256StarStar
+{
+public:
+  explicit Xoshiro256StarStar(std::uint64_t seed = 0)
+  {
+    SplitMix64 seeder(seed);
+    for (auto& s : m_s) {
+      s = seeder.next();
+    }
+  }
+
+  static constexpr int bits_per_call = 64;
+
+  std::uint64_t next()
+  {
+    const std::uint64_t result = rotl(m_s[1] * 5, 7) * 9;
+    const std::uint64_t t = m_s[1] << 17;
+    m_s[2] ^= m_s[0];
+    m_s[3] ^= m_s[1];
+    m_s[1] ^= m_s[2];
+    m_s[0] ^= m_s[3];
+    m_s[2] ^= t;
+    m_s[3] = rotl(m_s[3], 45);
+    return result;
+  }
+
+private:
+  static std::uint64_t rotl(std::uint64_t x, int k)
+  {
+    return (x << k) | (x >> (64 - k));
+  }
+  std::uint64_t m_s[4];
+};
@@ -9,6 +9,7 @@
 #include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include "perf_counters.h"
 #include "tiptap/lfsr.h"
 #if HAVE_VECTORCLASS
 #include "tiptap/lfsr_vectorclass.h"
@@ -98,8 +99,12 @@ run_impl()
 {
   LFSR x;
   const std::uint32_t maxreps = 1'000'000;
-  for (std::uint32_t i = 0; i < maxreps; ++i) {
-    x.next();
+  {
+    // one step gives one output bit
+    perf::Scope<LFSR> counters(maxreps, maxreps);
+    for (std::uint32_t i = 0; i < maxreps; ++i) {
+      x.next();
+    }
   }
   // return the hash of the state, to make it more difficult for the optimizer
   // to remove it
@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+
+"""Compares benchmark results written by the tiptap-json reporter against a
+stored baseline, and flags statistically significant changes.
+
+produce the files with, for instance:
+  ./benchmark -r tiptap-json::out=baseline.json
+  (upgrade the compiler, rebuild)
+  ./benchmark -r tiptap-json::out=current.json
+  ./compare_benchmarks.py baseline.json current.json
+
+a case is flagged when the confidence intervals of the means (computed by
+catch2 from the samples, by bootstrapping) do not overlap and the means
+differ by more than the threshold. exits with status 1 if any case
+regressed.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(filename):
+    with open(filename, encoding="utf-8") as f:
+        data = json.load(f)
+    results = {}
+    for b in data["benchmarks"]:
+        results[(b["test_case"], b["name"])] = b
+    return data["metadata"], results
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline", help="json file with the baseline")
+    parser.add_argument("current", help="json file with the new results")
+    parser.add_argument("--threshold", type=float, default=0.02,
+                        help="ignore relative changes smaller than this "
+                        "(default 0.02)")
+    parser.add_argument("--all", action="store_true",
+                        help="show all cases, not only the changed ones")
+    args = parser.parse_args()
+
+    base_meta, base = load(args.baseline)
+    cur_meta, cur = load(args.current)
+
+    for key in sorted(set(base_meta) | set(cur_meta)):
+        if base_meta.get(key) != cur_meta.get(key):
+            print(f"{key}: {base_meta.get(key)} -> {cur_meta.get(key)}")
+
+    regressions = 0
+    improvements = 0
+    for key in sorted(base.keys() & cur.keys()):
+        b = base[key]
+        c = cur[key]
+        change = c["mean"] / b["mean"] - 1 if b["mean"] > 0 else 0.0
+        if c["mean_lower_bound"] > b["mean_upper_bound"] and \
+                change > args.threshold:
+            verdict = "REGRESSION"
+            regressions += 1
+        elif c["mean_upper_bound"] < b["mean_lower_bound"] and \
+                -change > args.threshold:
+            verdict = "improvement"
+            improvements += 1
+        elif args.all:
+            verdict = ""
+        else:
+            continue
+        test_case, name = key
+        print(f"{test_case:20} {name:45} "
+              f"{b['mean']:12.1f} [{b['mean_lower_bound']:.1f}, "
+              f"{b['mean_upper_bound']:.1f}] -> "
+              f"{c['mean']:12.1f} [{c['mean_lower_bound']:.1f}, "
+              f"{c['mean_upper_bound']:.1f}] ns "
+              f"{100 * change:+6.1f}% {verdict}")
+
+    for key in sorted(base.keys() - cur.keys()):
+        print(f"only in baseline: {key[0]} {key[1]}")
+    for key in sorted(cur.keys() - base.keys()):
+        print(f"only in current: {key[0]} {key[1]}")
+
+    print(f"{len(base.keys() & cur.keys())} cases compared, "
+          f"{regressions} regressions, {improvements} improvements")
+    return 1 if regressions > 0 else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
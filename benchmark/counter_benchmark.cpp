@@ -0,0 +1,71 @@
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "timing.h"
+#include "tiptap/lfsr_counter.h"
+
+// the cost of an LfsrCounter in software, compared to a binary counter of the
+// same width. in hardware the LFSR wins since it has no carry chain, in
+// software both are a handful of instructions per count. the counters are
+// stepped in a dependent chain, so this measures the latency of one count.
+
+namespace {
+
+/// the usual modulo M counter
+template<typename State>
+class BinaryCounter
+{
+public:
+  explicit BinaryCounter(std::uint64_t modulus)
+    : m_last(static_cast<State>(modulus - 1))
+  {
+  }
+
+  bool next()
+  {
+    const bool wrap = m_state == m_last;
+    m_state = wrap ? State{} : static_cast<State>(m_state + 1);
+    return wrap;
+  }
+
+private:
+  State m_state{};
+  State m_last;
+};
+
+template<typename Counter>
+void
+measure(const std::string& name, Counter counter)
+{
+  constexpr std::uint32_t steps = 1'000'000;
+  std::uint32_t wraps = 0;
+  const double seconds = seconds_per_call([&]() {
+    for (std::uint32_t i = 0; i < steps; ++i) {
+      wraps += counter.next();
+    }
+  });
+  // keep the result alive
+  volatile std::uint32_t sink = wraps;
+  (void)sink;
+  std::printf("%-40s %10.3f\n", name.c_str(), seconds * 1e9 / steps);
+}
+}
+
+TEST_CASE("cost of counting")
+{
+  std::printf("%-40s %10s\n", "counter", "ns/count");
+  measure("BinaryCounter<uint16_t>(1000)", BinaryCounter<std::uint16_t>(1000));
+  measure("LfsrCounter<16, 1000>", LfsrCounter<16, 1000>{});
+  measure("LfsrCounter<16>(1000)", LfsrCounter<16>(1000));
+  measure("BinaryCounter<uint32_t>(10^9)",
+          BinaryCounter<std::uint32_t>(1'000'000'000));
+  measure("LfsrCounter<30, 10^9>", LfsrCounter<30, 1'000'000'000>{});
+  measure("LfsrCounter<30>(10^9)", LfsrCounter<30>(1'000'000'000));
+  measure("BinaryCounter<uint64_t>(10^15)",
+          BinaryCounter<std::uint64_t>(1'000'000'000'000'000));
+  measure("LfsrCounter<50, 10^15>", LfsrCounter<50, 1'000'000'000'000'000>{});
+  measure("LfsrCounter<50>(10^15)", LfsrCounter<50>(1'000'000'000'000'000));
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+// the extensive benchmark runs every implementation variant for every N in
+// [Nmin, Nmax]. the matrix is expressed with type lists and index sequences,
+// and is split over several translation units (extensive_benchmark_*.cpp)
+// so it compiles in parallel. each N becomes a test case named "N=<N>", which
+// is what parse_benchmark_xml.py expects.
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <utility>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "perf_counters.h"
+#include "tiptap/lfsr.h"
+
+namespace extensive {
+
+inline constexpr std::size_t Nmin = 3;
+inline constexpr std::size_t Nmax = 64;
+
+template<typename... Types>
+struct TypeList
+{
+};
+
+using Limbs =
+  TypeList<std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t>;
+
+template<typename Limb>
+constexpr const char*
+limb_name()
+{
+  if constexpr (std::is_same_v<Limb, std::uint8_t>)
+    return "std::uint8_t";
+  if constexpr (std::is_same_v<Limb, std::uint16_t>)
+    return "std::uint16_t";
+  if constexpr (std::is_same_v<Limb, std::uint32_t>)
+    return "std::uint32_t";
+  if constexpr (std::is_same_v<Limb, std::uint64_t>)
+    return "std::uint64_t";
+}
+
+inline std::uint32_t
+Fnva1aHash(std::span<const char> data)
+{
+  std::uint32_t state = 0x811c9dc5;
+  for (const auto d : data) {
+    state ^= d;
+    state *= 0x01000193;
+  }
+  return state;
+}
+
+template<typename LFSR>
+unsigned
+run_impl()
+{
+  LFSR x;
+  const std::uint32_t maxreps = 1'000'000;
+  {
+    perf::Scope<LFSR> counters(maxreps, maxreps);
+    for (std::uint32_t i = 0; i < maxreps; ++i) {
+      x.next();
+    }
+  }
+  // return the hash of the state, to make it more difficult for the optimizer
+  // to remove it
+  const auto tmp = x.state();
+  const auto* ptr = reinterpret_cast<const char*>(&tmp);
+  return Fnva1aHash(std::span<const char>(ptr, ptr + sizeof(tmp)));
+}
+
+template<typename LFSR>
+void
+benchmark(const std::string& name)
+{
+  BENCHMARK(name)
+  {
+    return run_impl<LFSR>();
+  };
+}
+
+inline std::string
+to_string(bool b)
+{
+  return b ? "true" : "false";
+}
+
+template<std::size_t N, typename... Limb>
+void
+benchmark_big(TypeList<Limb...>)
+{
+  const auto name = [](const char* limb, bool direct) {
+    return "BigLFSR<" + std::to_string(N) + ", " + limb + ", " +
+           to_string(direct) + ">";
+  };
+  ((benchmark<BigLFSR<N, Limb, true>>(name(limb_name<Limb>(), true)),
+    benchmark<BigLFSR<N, Limb, false>>(name(limb_name<Limb>(), false))),
+   ...);
+}
+
+/// the benchmarks for one N
+template<std::size_t N>
+void
+benchmark_size()
+{
+  for (bool direct : { true, false }) {
+    const auto name =
+      "SmallLFSR<" + std::to_string(N) + ", " + to_string(direct) + ">";
+    if (direct) {
+      benchmark<SmallLFSR<N, true>>(name);
+    } else {
+      benchmark<SmallLFSR<N, false>>(name);
+    }
+  }
+  benchmark_big<N>(Limbs{});
+}
+
+template<std::size_t N>
+void
+register_size()
+{
+  static_assert(N >= Nmin && N <= Nmax);
+  const std::string name = "N=" + std::to_string(N);
+  REGISTER_TEST_CASE(&benchmark_size<N>, name);
+}
+
+template<std::size_t First, std::size_t... offsets>
+bool
+register_sizes(std::index_sequence<offsets...>)
+{
+  (register_size<First + offsets>(), ...);
+  return true;
+}
+
+/// registers test cases for N in [First, Last]. call this during static
+/// initialization.
+template<std::size_t First, std::size_t Last>
+bool
+register_sizes()
+{
+  return register_sizes<First>(std::make_index_sequence<Last - First + 1>{});
+}
+} // namespace extensive
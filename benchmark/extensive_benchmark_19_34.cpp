@@ -0,0 +1,5 @@
+#include "extensive_benchmark.h"
+
+namespace {
+const bool registered = extensive::register_sizes<19, 34>();
+}
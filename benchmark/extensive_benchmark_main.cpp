@@ -0,0 +1,39 @@
+#include <algorithm>
+#include <string>
+
+#include <catch2/catch_session.hpp>
+
+#include "extensive_benchmark.h"
+
+// adds --nmin and --nmax, to benchmark a range of N without rebuilding. the
+// other options are the usual catch2 ones.
+int
+main(int argc, char* argv[])
+{
+  Catch::Session session;
+
+  std::size_t nmin = 0;
+  std::size_t nmax = 0;
+  using Catch::Clara::Opt;
+  session.cli(session.cli() |
+              Opt(nmin, "N")["--nmin"]("smallest N to benchmark") |
+              Opt(nmax, "N")["--nmax"]("largest N to benchmark"));
+
+  if (const int ret = session.applyCommandLine(argc, argv); ret != 0) {
+    return ret;
+  }
+
+  if (nmin != 0 || nmax != 0) {
+    nmin = std::max(nmin, extensive::Nmin);
+    nmax = nmax == 0 ? extensive::Nmax : std::min(nmax, extensive::Nmax);
+    // comma separated test names are OR:ed together
+    std::string filter;
+    for (std::size_t N = nmin; N <= nmax; ++N) {
+      filter += (filter.empty() ? "N=" : ",N=") + std::to_string(N);
+    }
+    // an empty range should run nothing, not everything
+    session.configData().testsOrTags.push_back(filter.empty() ? "~*" : filter);
+  }
+
+  return session.run();
+}
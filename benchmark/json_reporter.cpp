@@ -0,0 +1,183 @@
+// a catch2 reporter writing the benchmark results as json, together with
+// metadata about the machine and the build. use it with -r tiptap-json and
+// compare two result files with compare_benchmarks.py.
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_case_info.hpp>
+#include <catch2/interfaces/catch_interfaces_reporter.hpp>
+#include <catch2/reporters/catch_reporter_registrars.hpp>
+#include <catch2/reporters/catch_reporter_streaming_base.hpp>
+
+#include "benchmark_metadata.h"
+
+namespace {
+
+std::string
+escape(const std::string& s)
+{
+  std::ostringstream oss;
+  for (const char c : s) {
+    switch (c) {
+      case '"':
+        oss << "\\\"";
+        break;
+      case '\\':
+        oss << "\\\\";
+        break;
+      case '\n':
+        oss << "\\n";
+        break;
+      case '\t':
+        oss << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          oss << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+              << int(c) << std::dec;
+        } else {
+          oss << c;
+        }
+    }
+  }
+  return oss.str();
+}
+
+std::string
+quoted(const std::string& s)
+{
+  return '"' + escape(s) + '"';
+}
+
+std::string
+cpu_model()
+{
+  std::ifstream cpuinfo("/proc/cpuinfo");
+  std::string line;
+  while (std::getline(cpuinfo, line)) {
+    if (line.rfind("model name", 0) == 0) {
+      const auto colon = line.find(':');
+      if (colon != line.npos && colon + 2 <= line.size()) {
+        return line.substr(colon + 2);
+      }
+    }
+  }
+  return "unknown";
+}
+
+std::string
+compiler()
+{
+#if defined(__clang__)
+  return "clang " __clang_version__;
+#elif defined(__GNUC__)
+  return "gcc " __VERSION__;
+#elif defined(_MSC_FULL_VER)
+  return "msvc " + std::to_string(_MSC_FULL_VER);
+#else
+  return "unknown";
+#endif
+}
+
+// BenchmarkStats is a template in some catch2 versions and a plain class in
+// others. pick whichever exists, so benchmarkEnded() can be overridden.
+template<template<class...> class Stats>
+auto stats_type(int) -> Stats<>;
+template<class Stats>
+auto stats_type(long) -> Stats;
+using BenchmarkStats = decltype(stats_type<Catch::BenchmarkStats>(0));
+
+struct Result
+{
+  std::string test_case;
+  std::string name;
+  double mean{};
+  double mean_lower{};
+  double mean_upper{};
+  double confidence_interval{};
+  double standard_deviation{};
+  std::vector<double> samples;
+};
+
+class JsonReporter : public Catch::StreamingReporterBase
+{
+public:
+  using StreamingReporterBase::StreamingReporterBase;
+
+  static std::string getDescription()
+  {
+    return "Reports benchmark results as json, with machine metadata";
+  }
+
+  void testCaseStarting(const Catch::TestCaseInfo& info) override
+  {
+    StreamingReporterBase::testCaseStarting(info);
+    m_test_case = info.name;
+  }
+
+  void benchmarkEnded(const BenchmarkStats& stats) override
+  {
+    Result r;
+    r.test_case = m_test_case;
+    r.name = stats.info.name;
+    r.mean = stats.mean.point.count();
+    r.mean_lower = stats.mean.lower_bound.count();
+    r.mean_upper = stats.mean.upper_bound.count();
+    r.confidence_interval = stats.mean.confidence_interval;
+    r.standard_deviation = stats.standardDeviation.point.count();
+    for (const auto& sample : stats.samples) {
+      r.samples.push_back(sample.count());
+    }
+    m_results.push_back(std::move(r));
+  }
+
+  void testRunEnded(const Catch::TestRunStats& stats) override
+  {
+    StreamingReporterBase::testRunEnded(stats);
+    auto& out = m_stream;
+    out << std::setprecision(10);
+    out << "{\n  \"metadata\": {\n";
+    out << "    \"executable\": " << quoted(std::string(stats.runInfo.name))
+        << ",\n";
+    out << "    \"cpu\": " << quoted(cpu_model()) << ",\n";
+    out << "    \"hardware_threads\": " << std::thread::hardware_concurrency()
+        << ",\n";
+    out << "    \"compiler\": " << quoted(compiler()) << ",\n";
+    out << "    \"build_type\": " << quoted(TIPTAP_BUILD_TYPE) << ",\n";
+    out << "    \"flags\": " << quoted(TIPTAP_CXX_FLAGS) << ",\n";
+    out << "    \"commit\": " << quoted(TIPTAP_GIT_COMMIT) << "\n";
+    out << "  },\n  \"time_unit\": \"ns\",\n  \"benchmarks\": [";
+    for (std::size_t i = 0; i < m_results.size(); ++i) {
+      const auto& r = m_results[i];
+      out << (i == 0 ? "\n" : ",\n");
+      out << "    {\n";
+      out << "      \"test_case\": " << quoted(r.test_case) << ",\n";
+      out << "      \"name\": " << quoted(r.name) << ",\n";
+      out << "      \"mean\": " << r.mean << ",\n";
+      out << "      \"mean_lower_bound\": " << r.mean_lower << ",\n";
+      out << "      \"mean_upper_bound\": " << r.mean_upper << ",\n";
+      out << "      \"confidence_interval\": " << r.confidence_interval
+          << ",\n";
+      out << "      \"standard_deviation\": " << r.standard_deviation
+          << ",\n";
+      out << "      \"samples\": [";
+      for (std::size_t j = 0; j < r.samples.size(); ++j) {
+        out << (j == 0 ? "" : ", ") << r.samples[j];
+      }
+      out << "]\n    }";
+    }
+    out << "\n  ]\n}\n";
+  }
+
+private:
+  std::string m_test_case;
+  std::vector<Result> m_results;
+};
+} // namespace
+
+CATCH_REGISTER_REPORTER("tiptap-json", JsonReporter)
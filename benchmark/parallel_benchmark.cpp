@@ -0,0 +1,39 @@
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "tiptap/lfsr.h"
+#include "tiptap/parallel.h"
+
+namespace {
+template<typename LFSR>
+void
+benchmark_scaling(const std::string& name)
+{
+  // large enough to amortize the thread startup and the jumps
+  std::vector<std::byte> buffer(std::size_t{ 16 } << 20);
+  const unsigned maxthreads =
+    std::max(1U, std::thread::hardware_concurrency());
+  for (unsigned threads = 1; threads <= maxthreads; ++threads) {
+    BENCHMARK(name + " threads=" + std::to_string(threads))
+    {
+      LFSR lfsr;
+      parallel_generate(lfsr, std::span(buffer), threads);
+      return buffer.back();
+    };
+  }
+}
+}
+
+TEST_CASE("parallel generate scaling, 16 MiB")
+{
+  benchmark_scaling<BigLFSR<32, std::uint32_t>>("BigLFSR<32, std::uint32_t>");
+  benchmark_scaling<BigLFSR<64, std::uint64_t>>("BigLFSR<64, std::uint64_t>");
+  benchmark_scaling<BigLFSR<128, std::uint64_t>>(
+    "BigLFSR<128, std::uint64_t>");
+}
@@ -0,0 +1,263 @@
+#pragma once
+
+// optional hardware performance counters for the benchmarks, using
+// perf_event_open on linux. enable by setting the environment variable
+// TIPTAP_PERF_COUNTERS=1. the counters are read around each call to the
+// measured function and summarized per benchmarked type when the program
+// exits. if the counters are not available (not linux, or not permitted which
+// is common in containers) a note is printed and the benchmarks run as usual.
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <typeinfo>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace perf {
+
+enum Event
+{
+  Cycles,
+  Instructions,
+  Branches,
+  BranchMisses,
+  CacheReferences,
+  CacheMisses,
+  EventCount
+};
+
+/// sums of the counters, -1 means the event could not be counted
+struct Totals
+{
+  std::array<std::int64_t, EventCount> counts{};
+  /// how many steps (calls to next()) were made while counting
+  std::uint64_t steps{};
+  /// how many output bits were produced while counting
+  std::uint64_t bits{};
+};
+
+/// a group of counters which are enabled and disabled together
+class CounterGroup
+{
+public:
+  CounterGroup()
+  {
+#ifdef __linux__
+    constexpr std::array<std::uint64_t, EventCount> configs = {
+      PERF_COUNT_HW_CPU_CYCLES,          PERF_COUNT_HW_INSTRUCTIONS,
+      PERF_COUNT_HW_BRANCH_INSTRUCTIONS, PERF_COUNT_HW_BRANCH_MISSES,
+      PERF_COUNT_HW_CACHE_REFERENCES,    PERF_COUNT_HW_CACHE_MISSES
+    };
+    for (int i = 0; i < EventCount; ++i) {
+      perf_event_attr attr{};
+      attr.size = sizeof(attr);
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = configs[i];
+      // only the group leader starts disabled, the others follow it
+      attr.disabled = m_fds[Cycles] < 0 ? 1 : 0;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID;
+      m_fds[i] = static_cast<int>(syscall(
+        SYS_perf_event_open, &attr, 0, -1, m_fds[Cycles], 0));
+      if (i == Cycles && m_fds[i] < 0) {
+        // without the group leader, nothing can be counted
+        return;
+      }
+      if (m_fds[i] >= 0) {
+        ioctl(m_fds[i], PERF_EVENT_IOC_ID, &m_ids[i]);
+      }
+    }
+#endif
+  }
+  ~CounterGroup()
+  {
+#ifdef __linux__
+    for (int fd : m_fds) {
+      if (fd >= 0) {
+        close(fd);
+      }
+    }
+#endif
+  }
+  CounterGroup(const CounterGroup&) = delete;
+  CounterGroup& operator=(const CounterGroup&) = delete;
+
+  bool available() const { return m_fds[Cycles] >= 0; }
+
+  void start()
+  {
+#ifdef __linux__
+    ioctl(m_fds[Cycles], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(m_fds[Cycles], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+  }
+
+  /// stops counting and adds the counts to totals
+  void stop(Totals& totals)
+  {
+#ifdef __linux__
+    ioctl(m_fds[Cycles], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    // layout with PERF_FORMAT_GROUP|PERF_FORMAT_ID: nr, then {value, id}
+    std::array<std::uint64_t, 1 + 2 * EventCount> buf{};
+    if (read(m_fds[Cycles], buf.data(), sizeof(buf)) <= 0) {
+      return;
+    }
+    for (int i = 0; i < EventCount; ++i) {
+      if (m_fds[i] < 0) {
+        totals.counts[i] = -1;
+        continue;
+      }
+      for (std::uint64_t j = 0; j < buf[0]; ++j) {
+        if (buf[2 + 2 * j] == m_ids[i]) {
+          totals.counts[i] += static_cast<std::int64_t>(buf[1 + 2 * j]);
+        }
+      }
+    }
+#else
+    (void)totals;
+#endif
+  }
+
+private:
+  std::array<int, EventCount> m_fds{ -1, -1, -1, -1, -1, -1 };
+  std::array<std::uint64_t, EventCount> m_ids{};
+};
+
+/// keeps the totals per benchmarked type and prints them at exit
+class Registry
+{
+public:
+  Registry()
+    : m_enabled(std::getenv("TIPTAP_PERF_COUNTERS") != nullptr)
+  {
+  }
+  ~Registry()
+  {
+    if (m_group && m_group->available()) {
+      print();
+    }
+  }
+
+  /// returns nullptr if counting is disabled or not possible
+  CounterGroup* group()
+  {
+    if (!m_enabled) {
+      return nullptr;
+    }
+    if (!m_group) {
+      m_group = std::make_unique<CounterGroup>();
+      if (!m_group->available()) {
+        std::fprintf(stderr,
+                     "hardware performance counters are not available, check "
+                     "/proc/sys/kernel/perf_event_paranoid. continuing "
+                     "without them.\n");
+      }
+    }
+    return m_group->available() ? m_group.get() : nullptr;
+  }
+
+  Totals& totals_for(std::string name)
+  {
+    for (auto& [key, value] : m_totals) {
+      if (key == name) {
+        return *value;
+      }
+    }
+    m_totals.emplace_back(std::move(name), std::make_unique<Totals>());
+    return *m_totals.back().second;
+  }
+
+private:
+  void print() const
+  {
+    std::printf("%-50s %10s %10s %6s %10s %10s\n",
+                "hardware counters",
+                "cycles/bit",
+                "instr/step",
+                "IPC",
+                "br-miss/M",
+                "cache-miss/M");
+    for (const auto& [name, t] : m_totals) {
+      const auto per = [&](Event e, double n) {
+        return t->counts[e] < 0 || n == 0 ? -1.0 : t->counts[e] / n;
+      };
+      const double ipc = t->counts[Cycles] > 0 && t->counts[Instructions] >= 0
+                           ? double(t->counts[Instructions]) / t->counts[Cycles]
+                           : -1.0;
+      std::printf("%-50s %10.3f %10.3f %6.2f %10.1f %10.1f\n",
+                  name.c_str(),
+                  per(Cycles, double(t->bits)),
+                  per(Instructions, double(t->steps)),
+                  ipc,
+                  per(BranchMisses, t->steps * 1e-6),
+                  per(CacheMisses, t->steps * 1e-6));
+    }
+  }
+
+  bool m_enabled;
+  std::unique_ptr<CounterGroup> m_group;
+  std::vector<std::pair<std::string, std::unique_ptr<Totals>>> m_totals;
+};
+
+inline Registry registry;
+
+/// gives a readable name for T
+template<typename T>
+std::string
+type_name()
+{
+#if defined(__GNUC__)
+  std::string_view name = __PRETTY_FUNCTION__;
+#else
+  std::string_view name = typeid(T).name();
+#endif
+  const auto begin = name.find("T = ");
+  if (begin == name.npos) {
+    return std::string(name);
+  }
+  name.remove_prefix(begin + 4);
+  return std::string(name.substr(0, name.find_first_of(";]")));
+}
+
+/// counts the events during its lifetime, if counting is enabled
+template<typename T>
+class Scope
+{
+public:
+  Scope(std::uint64_t steps, std::uint64_t bits)
+    : m_group(registry.group())
+  {
+    if (m_group) {
+      static Totals& totals = registry.totals_for(type_name<T>());
+      m_totals = &totals;
+      m_totals->steps += steps;
+      m_totals->bits += bits;
+      m_group->start();
+    }
+  }
+  ~Scope()
+  {
+    if (m_group) {
+      m_group->stop(*m_totals);
+    }
+  }
+  Scope(const Scope&) = delete;
+  Scope& operator=(const Scope&) = delete;
+
+private:
+  CounterGroup* m_group;
+  Totals* m_totals{};
+};
+} // namespace perf
@@ -0,0 +1,241 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "baseline_prngs.h"
+#include "timing.h"
+#include "tiptap/lfsr.h"
+#include "tiptap/tausworthe.h"
+
+#if HAVE_AES
+#include "tiptap/encrypted_counter.h"
+#endif
+
+// compares the lfsr implementations against commonly used pseudo random
+// generators. the generators produce a different number of bits per call, so
+// the comparison is made on output bits: the latency of one call is divided by
+// the number of bits it produces, and the bulk fill writes the same number of
+// bytes for all of them.
+
+namespace {
+
+constexpr std::size_t cache_resident_size = std::size_t{ 16 } << 10;
+constexpr std::size_t dram_size = std::size_t{ 64 } << 20;
+
+/// packs the lowest Bits bits of each value from next into out, lsb first
+template<int Bits, typename F>
+void
+pack_bits(std::span<std::byte> out, F&& next)
+{
+  static_assert(Bits > 0 && Bits <= 64);
+  constexpr std::uint64_t mask =
+    Bits == 64 ? ~std::uint64_t{} : (std::uint64_t{ 1 } << Bits) - 1;
+  std::uint64_t word = 0;
+  unsigned fill = 0;
+  std::size_t pos = 0;
+  while (pos < out.size()) {
+    const std::uint64_t value = next() & mask;
+    word |= value << fill;
+    fill += Bits;
+    if (fill >= 64) {
+      const auto n = std::min(sizeof(word), out.size() - pos);
+      std::memcpy(out.data() + pos, &word, n);
+      pos += n;
+      fill -= 64;
+      word = fill > 0 ? value >> (Bits - fill) : 0;
+    }
+  }
+}
+
+/// adapts a standard library style engine
+template<typename Engine, int Bits>
+struct EngineSource
+{
+  static constexpr int bits_per_call = Bits;
+  std::uint64_t next() { return m_engine(); }
+  void generate(std::span<std::byte> out)
+  {
+    pack_bits<Bits>(out, [this]() { return m_engine(); });
+  }
+  Engine m_engine;
+};
+
+/// adapts the generators in baseline_prngs.h
+template<typename Generator>
+struct BaselineSource
+{
+  static constexpr int bits_per_call = Generator::bits_per_call;
+  std::uint64_t next() { return m_generator.next(); }
+  void generate(std::span<std::byte> out)
+  {
+    pack_bits<bits_per_call>(out, [this]() { return m_generator.next(); });
+  }
+  Generator m_generator;
+};
+
+template<typename LFSR>
+struct LfsrSource
+{
+  static constexpr int bits_per_call = 1;
+  std::uint64_t next()
+  {
+    m_lfsr.next();
+    return m_lfsr.output();
+  }
+  void generate(std::span<std::byte> out) { m_lfsr.generate(out); }
+  LFSR m_lfsr;
+};
+
+#if HAVE_AES
+/// aes-128 in counter mode, the counter is the low 64 bit lane
+struct AesCtrSource
+{
+  static constexpr int bits_per_call = 128;
+  std::uint64_t next()
+  {
+    const auto block = step();
+    return static_cast<std::uint64_t>(_mm_cvtsi128_si64(block));
+  }
+  void generate(std::span<std::byte> out)
+  {
+    std::size_t pos = 0;
+    for (; pos + 16 <= out.size(); pos += 16) {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out.data() + pos), step());
+    }
+    if (pos < out.size()) {
+      std::array<std::byte, 16> tail;
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(tail.data()), step());
+      std::memcpy(out.data() + pos, tail.data(), out.size() - pos);
+    }
+  }
+  __m128i step()
+  {
+    const auto block = m_aes.encrypt(m_counter);
+    m_counter = _mm_add_epi64(m_counter, _mm_set_epi64x(0, 1));
+    return block;
+  }
+  Aes m_aes;
+  __m128i m_counter = _mm_setzero_si128();
+};
+
+/// the encrypted counter, either one block at a time or with
+/// EncryptedCounter::BlocksInFlight blocks encrypted together
+template<bool pipelined>
+struct EncryptedCounterSource
+{
+  static constexpr int bits_per_call = 128;
+  std::uint64_t next()
+  {
+    const auto block = m_counter.next_block();
+    return static_cast<std::uint64_t>(_mm_cvtsi128_si64(block));
+  }
+  void generate(std::span<std::byte> out)
+  {
+    if constexpr (pipelined) {
+      m_counter.generate(out);
+    } else {
+      for (std::size_t pos = 0; pos < out.size(); pos += 16) {
+        const auto block = m_counter.next_block();
+        std::memcpy(out.data() + pos,
+                    &block,
+                    std::min(sizeof(block), out.size() - pos));
+      }
+    }
+  }
+  EncryptedCounter m_counter;
+};
+#endif
+
+/// time for one call when each call depends on the previous one
+template<typename Source>
+double
+latency_ns()
+{
+  constexpr std::uint32_t calls = 1'000'000;
+  Source source;
+  std::uint64_t sink = 0;
+  const double seconds = seconds_per_call([&]() {
+    for (std::uint32_t i = 0; i < calls; ++i) {
+      sink ^= source.next();
+    }
+  });
+  volatile std::uint64_t keep = sink;
+  (void)keep;
+  return seconds * 1e9 / calls;
+}
+
+template<typename Source>
+void
+compare(const std::string& name)
+{
+  const double latency = latency_ns<Source>();
+  for (std::size_t size : { cache_resident_size, dram_size }) {
+    std::vector<std::byte> buffer(size);
+    Source source;
+    const double seconds =
+      seconds_per_call([&]() { source.generate(std::span(buffer)); });
+    print_throughput_row(name + " (" +
+                           std::to_string(Source::bits_per_call) +
+                           " bits/call)",
+                         size,
+                         latency,
+                         seconds);
+  }
+}
+}
+
+TEST_CASE("the baseline generators give the reference output")
+{
+  // from the reference implementation of splitmix64
+  SplitMix64 splitmix(0);
+  REQUIRE(splitmix.next() == 0xe220a8397b1dcdaf);
+
+  // pack_bits must not lose or duplicate bits when the values straddle words
+  std::uint64_t counter = 0;
+  std::array<std::byte, 31> packed{};
+  pack_bits<31>(packed, [&counter]() { return counter++ * 0x12345 + 1; });
+  for (unsigned bit = 0; bit < packed.size() * 8; ++bit) {
+    const std::uint64_t value = (bit / 31) * 0x12345 + 1;
+    const bool expected = (value >> (bit % 31)) & 1;
+    const bool actual =
+      (std::to_integer<unsigned>(packed[bit / 8]) >> (bit % 8)) & 1;
+    REQUIRE(actual == expected);
+  }
+
+#if HAVE_AES
+  // the FIPS-197 known answer
+  const Aes aes;
+  REQUIRE(aes.encrypt("00112233445566778899aabbccddeeff"_128bithex) ==
+          "69c4e0d86a7b0430d8cdb78070b4c55a"_128bithex);
+#endif
+}
+
+TEST_CASE("comparison against other generators")
+{
+  print_throughput_header();
+  compare<LfsrSource<SmallLFSR<64>>>("SmallLFSR<64>");
+  compare<LfsrSource<BigLFSR<64, std::uint64_t>>>(
+    "BigLFSR<64, std::uint64_t>");
+  compare<LfsrSource<BigLFSR<128, std::uint64_t>>>(
+    "BigLFSR<128, std::uint64_t>");
+  compare<EngineSource<std::mt19937_64, 64>>("std::mt19937_64");
+  // the output is in [1, 2^31-2], so only 31 bits are used per call
+  compare<EngineSource<std::minstd_rand, 31>>("std::minstd_rand");
+  compare<BaselineSource<Xoshiro256StarStar>>("xoshiro256**");
+  compare<BaselineSource<SplitMix64>>("splitmix64");
+  compare<EngineSource<Taus88, 32>>("taus88");
+  compare<EngineSource<Lfsr113, 32>>("lfsr113");
+  compare<EngineSource<Lfsr258, 64>>("lfsr258");
+#if HAVE_AES
+  compare<AesCtrSource>("aes-128 ctr");
+  compare<EncryptedCounterSource<false>>("EncryptedCounter, one block");
+  compare<EncryptedCounterSource<true>>("EncryptedCounter, 8 blocks");
+#endif
+}
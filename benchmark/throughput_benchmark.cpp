@@ -0,0 +1,490 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <ranges>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "timing.h"
+#include "tiptap/checkpoint.h"
+#include "tiptap/clock_controlled.h"
+#include "tiptap/correlation.h"
+#include "tiptap/lfsr.h"
+#include "tiptap/nonlinear.h"
+#include "tiptap/shrinking.h"
+#include "tiptap/spreading_codes.h"
+
+// throughput oriented benchmarks. the benchmark in benchmark.cpp measures a
+// chain of dependent next() calls, which is the latency of one step. here the
+// output is consumed in bulk, or from several independent generators, and
+// the results are printed as bits/s and bytes/s next to the latency so the
+// trade-off between the implementations is visible.
+//
+// the measurements are done with a plain timer instead of catch2 BENCHMARK,
+// to be able to report throughput.
+
+namespace {
+
+constexpr std::size_t cache_resident_size = std::size_t{ 16 } << 10;
+constexpr std::size_t dram_size = std::size_t{ 64 } << 20;
+
+/// time for one step when each step depends on the previous one
+template<typename LFSR>
+double
+latency_ns()
+{
+  constexpr std::uint32_t steps = 1'000'000;
+  LFSR lfsr;
+  const double seconds = seconds_per_call([&lfsr]() {
+    for (std::uint32_t i = 0; i < steps; ++i) {
+      lfsr.next();
+    }
+  });
+  // keep the result alive
+  volatile bool sink = lfsr.output();
+  (void)sink;
+  return seconds * 1e9 / steps;
+}
+
+/// K independent generators stepped together. this generalizes the Tandem
+/// experiment in benchmark.cpp: the steps of the different instances do not
+/// depend on each other, so they can execute in parallel in the cpu. the
+/// output interleaves the bits of the instances.
+template<typename LFSR, std::size_t K>
+class Bank
+{
+public:
+  Bank()
+  {
+    // start the instances at different positions, so they are not identical
+    for (std::size_t i = 0; i < K; ++i) {
+      m_lfsrs[i].jump(i * 1000);
+    }
+  }
+
+  void next()
+  {
+    for (auto& lfsr : m_lfsrs) {
+      lfsr.next();
+    }
+  }
+
+  void generate(std::span<std::byte> out)
+  {
+    static_assert(64 % K == 0 || K % 64 == 0);
+    std::uint64_t word = 0;
+    unsigned fill = 0;
+    std::size_t pos = 0;
+    while (pos < out.size()) {
+      for (auto& lfsr : m_lfsrs) {
+        word |= std::uint64_t{ lfsr.output() } << fill;
+        lfsr.next();
+        if (++fill == 64) {
+          const auto n = std::min(sizeof(word), out.size() - pos);
+          std::memcpy(out.data() + pos, &word, n);
+          pos += n;
+          word = 0;
+          fill = 0;
+        }
+      }
+    }
+  }
+
+  bool output() const { return m_lfsrs[0].output(); }
+
+private:
+  std::array<LFSR, K> m_lfsrs;
+};
+
+template<typename Generator>
+void
+bulk_fill(const std::string& name, double latency)
+{
+  for (std::size_t size : { cache_resident_size, dram_size }) {
+    std::vector<std::byte> buffer(size);
+    Generator generator;
+    const double seconds =
+      seconds_per_call([&]() { generator.generate(std::span(buffer)); });
+    print_throughput_row(name, size, latency, seconds);
+  }
+}
+
+template<typename LFSR>
+void
+bulk_fill(const std::string& name)
+{
+  bulk_fill<LFSR>(name, latency_ns<LFSR>());
+}
+
+template<typename LFSR, std::size_t... K>
+void
+banks(const std::string& name, std::index_sequence<K...>)
+{
+  const double latency = latency_ns<LFSR>();
+  (bulk_fill<Bank<LFSR, K>>(std::to_string(K) + " x " + name, latency), ...);
+}
+
+using A51Style = ClockControlledGenerator<MajorityClocking<8, 10, 10>,
+                                          SmallLFSR<19>,
+                                          SmallLFSR<22>,
+                                          SmallLFSR<23>>;
+
+/// the output of all lanes of a bitsliced A5/1 style generator, counted as
+/// bytes
+template<typename Word>
+void
+bitsliced_fill(const std::string& name, double latency)
+{
+  using Bitsliced =
+    BitslicedClockControlledGenerator<Word,
+                                      MajorityClocking<8, 10, 10>,
+                                      SmallLFSR<19>,
+                                      SmallLFSR<22>,
+                                      SmallLFSR<23>>;
+  std::vector<A51Style> keys(detail::lane_count<Word>);
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    SmallLFSR<19> a;
+    a.jump(i + 1);
+    keys[i] = A51Style(a, SmallLFSR<22>{}, SmallLFSR<23>{});
+  }
+  Bitsliced generator(keys);
+  std::vector<Word> out(cache_resident_size * 8 / detail::lane_count<Word>);
+  const double seconds =
+    seconds_per_call([&]() { generator.generate(std::span(out)); });
+  print_throughput_row(name, cache_resident_size, latency, seconds);
+}
+}
+
+TEST_CASE("throughput of bulk fill")
+{
+  print_throughput_header();
+  bulk_fill<SmallLFSR<32>>("SmallLFSR<32>");
+  bulk_fill<SmallLFSR<64>>("SmallLFSR<64>");
+  bulk_fill<BigLFSR<32, std::uint32_t>>("BigLFSR<32, std::uint32_t>");
+  bulk_fill<BigLFSR<64, std::uint64_t>>("BigLFSR<64, std::uint64_t>");
+  bulk_fill<BigLFSR<128, std::uint64_t>>("BigLFSR<128, std::uint64_t>");
+  bulk_fill<BigLFSR<1024, std::uint64_t>>("BigLFSR<1024, std::uint64_t>");
+  bulk_fill<BigLFSR<4096, std::uint64_t>>("BigLFSR<4096, std::uint64_t>");
+}
+
+TEST_CASE("throughput of independent instances")
+{
+  print_throughput_header();
+  banks<SmallLFSR<32>>("SmallLFSR<32>",
+                       std::index_sequence<1, 2, 4, 8, 16, 32>{});
+  banks<BigLFSR<64, std::uint64_t>>("BigLFSR<64, std::uint64_t>",
+                                    std::index_sequence<1, 2, 4, 8, 16, 32>{});
+}
+
+TEST_CASE("throughput of decimated generators")
+{
+  // the latency column is for one step of the underlying lfsr
+  print_throughput_header();
+  const double latency = latency_ns<BigLFSR<64, std::uint64_t>>();
+  bulk_fill<BigLFSR<64, std::uint64_t>>("BigLFSR<64, std::uint64_t>", latency);
+  bulk_fill<ShrinkingGenerator<61, 89>>("ShrinkingGenerator<61, 89>", latency);
+  bulk_fill<SelfShrinkingGenerator<64>>("SelfShrinkingGenerator<64>", latency);
+}
+
+namespace {
+/// a filter generator on 6 taps of a 128 bit LFSR, with a function of degree 3
+struct Filtered128 : FilteredLFSR<128, 6>
+{
+  Filtered128()
+    : FilteredLFSR<128, 6>(BooleanFunction<6>::from_anf(
+                             { 0b000001, 0b000110, 0b011000, 0b101010 }),
+                           { 0, 5, 31, 64, 100, 127 })
+  {
+  }
+};
+
+using GeffeLFSR = CombinedLFSR<BigLFSR<61, std::uint64_t>,
+                               BigLFSR<64, std::uint64_t>,
+                               BigLFSR<89, std::uint64_t>>;
+
+/// the Geffe generator with three registers
+struct Geffe : GeffeLFSR
+{
+  Geffe()
+    : GeffeLFSR(geffe(), {}, {}, {})
+  {
+  }
+};
+}
+
+TEST_CASE("throughput of nonlinear generators")
+{
+  // the latency column is for one step of the underlying lfsr
+  print_throughput_header();
+  const double latency = latency_ns<BigLFSR<128, std::uint64_t>>();
+  bulk_fill<BigLFSR<128, std::uint64_t>>("BigLFSR<128, std::uint64_t>",
+                                         latency);
+  bulk_fill<Filtered128>("FilteredLFSR<128, 6>", latency);
+  bulk_fill<Geffe>("CombinedLFSR, Geffe of 61, 64, 89", latency);
+}
+
+TEST_CASE("throughput of bitsliced clock controlled generators")
+{
+  // many independent keys at once, as in cryptanalysis. the latency column
+  // is for one step of the scalar generator.
+  print_throughput_header();
+  const double latency = latency_ns<A51Style>();
+  bulk_fill<A51Style>("A5/1 style, scalar", latency);
+  bitsliced_fill<std::uint64_t>("A5/1 style, bitsliced 64 lanes", latency);
+  bitsliced_fill<LaneWord<4>>("A5/1 style, bitsliced 256 lanes", latency);
+  bitsliced_fill<LaneWord<8>>("A5/1 style, bitsliced 512 lanes", latency);
+}
+
+namespace {
+/// the time to set up a family and write all its codes
+template<typename Family>
+void
+family_fill(const std::string& name)
+{
+  std::vector<std::uint64_t> out(Family::Size * Family::WordsPerCode);
+  const double seconds = seconds_per_call([&]() {
+    const Family family;
+    family.generate(out);
+  });
+  std::printf("%-52s %10llu codes %10.1f us\n",
+              name.c_str(),
+              static_cast<unsigned long long>(Family::Size),
+              seconds * 1e6);
+}
+}
+
+TEST_CASE("generating spreading code families")
+{
+  family_fill<GoldFamily<10>>("GoldFamily<10>");
+  family_fill<GoldFamily<11>>("GoldFamily<11>");
+  family_fill<KasamiFamily<10>>("KasamiFamily<10>");
+  family_fill<KasamiFamily<16>>("KasamiFamily<16>");
+}
+
+namespace {
+/// the time for the autocorrelation of the size N m-sequence at all shifts.
+/// the rate is in compared bits, length^2 per spectrum.
+template<std::size_t N>
+void
+autocorrelation(const std::string& name, unsigned threads)
+{
+  constexpr std::uint64_t length = (std::uint64_t{ 1 } << N) - 1;
+  std::vector<std::uint64_t> u((length + 63) / 64);
+  BigLFSR<N, std::uint64_t> lfsr;
+  lfsr.generate(std::as_writable_bytes(std::span(u)));
+  u.back() &= (std::uint64_t{ 1 } << (length % 64)) - 1;
+  const double seconds = seconds_per_call(
+    [&]() { static_cast<void>(periodic_autocorrelation(u, length, threads)); });
+  std::printf("%-52s %10.3f s %10.1f Gbit/s\n",
+              name.c_str(),
+              seconds,
+              double(length) * double(length) / seconds * 1e-9);
+}
+}
+
+TEST_CASE("correlation spectra")
+{
+  const unsigned threads = std::thread::hardware_concurrency();
+  autocorrelation<16>("autocorrelation 2^16-1, 1 thread", 1);
+  autocorrelation<16>("autocorrelation 2^16-1, all threads", threads);
+  autocorrelation<20>("autocorrelation 2^20-1, 1 thread", 1);
+  autocorrelation<20>("autocorrelation 2^20-1, all threads", threads);
+}
+
+namespace {
+/// K taps spread over a size N LFSR, the first one being N
+template<std::size_t N, std::size_t K>
+constexpr auto
+spread_taps()
+{
+  return []<std::size_t... i>(std::index_sequence<i...>) {
+    return std::index_sequence<(N - i * (N / K))...>{};
+  }(std::make_index_sequence<K>{});
+}
+
+/// ns per step of BigLFSR<N> with K taps, with the feedback computed the
+/// sparse way (one shift per tap) and the dense way (and+popcount)
+template<std::size_t N, std::size_t K>
+void
+feedback_cost()
+{
+  using Taps = decltype(spread_taps<N, K>());
+  using State = BigNum<N, std::uint64_t>;
+  constexpr State mask = [] {
+    State ret{};
+    [&]<std::size_t... taps>(std::index_sequence<taps...>) {
+      (ret.set_bit_to(N - taps, true), ...);
+    }(Taps{});
+    return ret;
+  }();
+  constexpr std::uint32_t steps = 1'000'000;
+  State state;
+  state.set_bit_to(0, true);
+
+  const double sparse = seconds_per_call([&]() {
+    [&]<std::size_t... taps>(std::index_sequence<taps...>) {
+      for (std::uint32_t i = 0; i < steps; ++i) {
+        state.shr_one_bit(
+          state.parity_into_topbit(std::index_sequence<(N - taps)...>{}));
+      }
+    }(Taps{});
+  });
+  const double dense = seconds_per_call([&]() {
+    for (std::uint32_t i = 0; i < steps; ++i) {
+      state.shr_one_bit(masked_parity<mask>(state));
+    }
+  });
+  volatile bool sink = state.ith_bit(0);
+  (void)sink;
+  std::printf("%-52s %10.2f ns %10.2f ns\n",
+              ("N=" + std::to_string(N) + ", " + std::to_string(K) + " taps")
+                .c_str(),
+              sparse * 1e9 / steps,
+              dense * 1e9 / steps);
+}
+
+template<std::size_t N, std::size_t... K>
+void
+feedback_costs(std::index_sequence<K...>)
+{
+  (feedback_cost<N, K>(), ...);
+}
+}
+
+TEST_CASE("feedback of sparse and dense taps")
+{
+  // the crossovers decide detail::dense_tap_threshold in lfsr_big.h
+  std::printf("%-52s %13s %13s\n", "taps", "sparse", "dense");
+  using Counts = std::index_sequence<2, 4, 6, 8, 10, 12, 16, 24, 32>;
+  feedback_costs<64>(Counts{});
+  feedback_costs<128>(Counts{});
+  feedback_costs<1024>(Counts{});
+}
+
+namespace {
+/// prints the rate of saving, loading and mapping a bank of 10^7 states. the
+/// file is in the temporary directory, so this is mostly the page cache, and
+/// the copying and checking in checkpoint.h should not be noticeable next to
+/// it.
+template<typename LFSR>
+void
+checkpoint_rate(const std::string& name)
+{
+  constexpr std::size_t count = 10'000'000;
+  const auto path =
+    std::filesystem::temp_directory_path() / "tiptap_checkpoint_benchmark";
+  std::vector<LFSR> bank(count);
+  for (std::size_t i = 0; i < count; i += 1000) {
+    bank[i].jump(i);
+  }
+  const double bytes = double(sizeof(LFSR)) * count;
+  auto row = [&](const char* what, double seconds) {
+    std::printf("%-52s %10s %10.2f GB/s %10.1f Mstates/s\n",
+                (name + " " + what).c_str(),
+                format_size(sizeof(LFSR) * count).c_str(),
+                bytes / seconds * 1e-9,
+                count / seconds * 1e-6);
+  };
+
+  row("save", seconds_per_call([&]() {
+        if (save_bank(path, std::span<const LFSR>(bank)) !=
+            CheckpointStatus::ok) {
+          std::abort();
+        }
+      }));
+  std::vector<LFSR> loaded;
+  row("load", seconds_per_call([&]() {
+        if (load_bank(path, loaded) != CheckpointStatus::ok) {
+          std::abort();
+        }
+      }));
+#ifdef TIPTAP_HAS_MMAP
+  // touches every state, as a simulation would
+  row("map and read", seconds_per_call([&]() {
+        MappedBank<LFSR> mapped(path);
+        bool sum = false;
+        for (const auto& lfsr : mapped.states()) {
+          sum ^= lfsr.output();
+        }
+        volatile bool sink = sum;
+        (void)sink;
+      }));
+#endif
+  std::filesystem::remove(path);
+}
+}
+
+TEST_CASE("checkpoint of a bank")
+{
+  std::printf("%-52s %10s %15s %20s\n", "bank", "size", "rate", "states");
+  checkpoint_rate<SmallLFSR<32>>("SmallLFSR<32>");
+  checkpoint_rate<BigLFSR<128, std::uint64_t>>("BigLFSR<128, std::uint64_t>");
+}
+
+namespace {
+/// xors the output of lfsr, taken through the bulk api and through each of
+/// the range views. the views should be within a few percent of the bulk api.
+template<typename LFSR>
+void
+ranges_vs_bulk(const std::string& name)
+{
+  constexpr std::size_t words = cache_resident_size / 8;
+  const double latency = latency_ns<LFSR>();
+  LFSR lfsr;
+  std::uint64_t sum = 0;
+
+  std::vector<std::uint64_t> buffer(words);
+  const double bulk = seconds_per_call([&]() {
+    LFSR copy = lfsr;
+    copy.generate(std::as_writable_bytes(std::span(buffer)));
+    for (auto w : buffer) {
+      sum ^= w;
+    }
+  });
+  print_throughput_row(name + " generate", words * 8, latency, bulk);
+
+  const double chunks = seconds_per_call([&]() {
+    std::size_t n = 0;
+    for (auto chunk : lfsr.chunks()) {
+      for (auto w : chunk) {
+        sum ^= w;
+      }
+      if ((n += chunk.size()) >= words) {
+        break;
+      }
+    }
+  });
+  print_throughput_row(name + " chunks()", words * 8, latency, chunks);
+
+  const double word_view = seconds_per_call([&]() {
+    for (auto w : lfsr.words() | std::views::take(words)) {
+      sum ^= w;
+    }
+  });
+  print_throughput_row(name + " words()", words * 8, latency, word_view);
+
+  const double bit_view = seconds_per_call([&]() {
+    for (bool b : lfsr.bits() | std::views::take(words * 64)) {
+      sum += b;
+    }
+  });
+  print_throughput_row(name + " bits()", words * 8, latency, bit_view);
+
+  volatile std::uint64_t sink = sum;
+  (void)sink;
+}
+}
+
+TEST_CASE("throughput of the output ranges")
+{
+  print_throughput_header();
+  ranges_vs_bulk<SmallLFSR<32>>("SmallLFSR<32>");
+  ranges_vs_bulk<BigLFSR<64, std::uint64_t>>("BigLFSR<64, std::uint64_t>");
+  ranges_vs_bulk<BigLFSR<1024, std::uint64_t>>("BigLFSR<1024, std::uint64_t>");
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+// helpers for the benchmarks that report throughput, which catch2 BENCHMARK
+// does not do
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+/// calls f repeatedly and returns the fastest time for one call, in seconds
+template<typename F>
+double
+seconds_per_call(F&& f)
+{
+  using clock = std::chrono::steady_clock;
+  const auto min_total = std::chrono::milliseconds(200);
+  double best = 1e300;
+  const auto start = clock::now();
+  int calls = 0;
+  do {
+    const auto before = clock::now();
+    f();
+    const auto after = clock::now();
+    best =
+      std::min(best, std::chrono::duration<double>(after - before).count());
+    ++calls;
+  } while (calls < 3 || clock::now() - start < min_total);
+  return best;
+}
+
+inline std::string
+format_size(std::size_t bytes)
+{
+  if (bytes >= (std::size_t{ 1 } << 20)) {
+    return std::to_string(bytes >> 20) + " MiB";
+  }
+  return std::to_string(bytes >> 10) + " KiB";
+}
+
+inline void
+print_throughput_header()
+{
+  std::printf("%-52s %10s %12s %10s %10s %10s\n",
+              "implementation",
+              "buffer",
+              "latency ns",
+              "ns/bit",
+              "Mbit/s",
+              "GB/s");
+}
+
+/// latency_ns is the time for one dependent call of a single generator
+inline void
+print_throughput_row(const std::string& name,
+                     std::size_t bytes,
+                     double latency_ns,
+                     double seconds)
+{
+  const double bits = 8.0 * bytes;
+  std::printf("%-52s %10s %12.3f %10.3f %10.1f %10.3f\n",
+              name.c_str(),
+              format_size(bytes).c_str(),
+              latency_ns,
+              seconds * 1e9 / bits,
+              bits / seconds * 1e-6,
+              bytes / seconds * 1e-9);
+}
@@ -0,0 +1,151 @@
+#include <bit>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <tiptap/encrypted_counter.h>
+#include <tiptap/statistical_tests.h>
+
+// finds the fewest aes rounds for which the encrypted counter passes the
+// statistical tests. each round count gets a fresh generator, the output is
+// streamed through the tests and the time spent generating it is measured.
+//
+// usage: roundsweep [--megabytes N] [--key-bits 128|256] [--alpha A]
+//                   [--progress 1]
+//
+// with --progress, the p-values so far are printed to stderr each time the
+// amount of tested data has doubled.
+
+namespace {
+
+struct Options
+{
+  std::size_t megabytes = 64;
+  unsigned key_bits = 256;
+  double alpha = 1e-6;
+  bool progress = false;
+};
+
+std::optional<Options>
+parse(int argc, char* argv[])
+{
+  Options options;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    const std::string flag = argv[i];
+    if (flag == "--megabytes") {
+      options.megabytes = std::strtoull(argv[i + 1], nullptr, 10);
+    } else if (flag == "--key-bits") {
+      options.key_bits = static_cast<unsigned>(std::atoi(argv[i + 1]));
+    } else if (flag == "--alpha") {
+      options.alpha = std::atof(argv[i + 1]);
+    } else if (flag == "--progress") {
+      options.progress = std::atoi(argv[i + 1]) != 0;
+    } else {
+      return std::nullopt;
+    }
+  }
+  if (argc % 2 == 0 || options.megabytes == 0 ||
+      (options.key_bits != 128 && options.key_bits != 256)) {
+    return std::nullopt;
+  }
+  return options;
+}
+
+Aes
+make_cipher(unsigned key_bits, std::size_t rounds)
+{
+  // the keys from the examples in FIPS-197
+  if (key_bits == 128) {
+    return Aes("000102030405060708090a0b0c0d0e0f"_128bithex, rounds);
+  }
+  Aes::ThirtyTwoByte key;
+  for (std::size_t i = 0; i < key.size(); ++i) {
+    key[i] = static_cast<std::uint8_t>(i);
+  }
+  return Aes(key, rounds);
+}
+
+struct Outcome
+{
+  std::vector<TestResult> results;
+  double bytes_per_second;
+};
+
+void
+print_results(const std::vector<TestResult>& results, std::FILE* out)
+{
+  for (const auto& r : results) {
+    std::fprintf(out, " %s=%.3g", r.name.c_str(), r.p_value);
+  }
+  std::fprintf(out, "\n");
+}
+
+Outcome
+evaluate(const Aes& cipher, const Options& options)
+{
+  const std::size_t megabytes = options.megabytes;
+  EncryptedCounter counter(cipher);
+  TestBattery battery;
+  std::vector<std::uint64_t> buffer((std::size_t{ 1 } << 20) / 8);
+  std::chrono::duration<double> generating{};
+  for (std::size_t i = 0; i < megabytes; ++i) {
+    const auto before = std::chrono::steady_clock::now();
+    counter.generate(std::as_writable_bytes(std::span(buffer)));
+    generating += std::chrono::steady_clock::now() - before;
+    battery.update(buffer);
+    if (options.progress && std::has_single_bit(i + 1)) {
+      std::fprintf(stderr, "  %zu MiB:", i + 1);
+      print_results(battery.results(), stderr);
+    }
+  }
+  return { battery.results(),
+           static_cast<double>(megabytes << 20) / generating.count() };
+}
+}
+
+int
+main(int argc, char* argv[])
+{
+  const auto options = parse(argc, argv);
+  if (!options) {
+    std::fprintf(stderr,
+                 "usage: %s [--megabytes N] [--key-bits 128|256] [--alpha "
+                 "A] [--progress 1]\n",
+                 argv[0]);
+    return EXIT_FAILURE;
+  }
+  const std::size_t max_rounds =
+    options->key_bits == 128 ? Aes::MaxRounds128 : Aes::MaxRounds256;
+
+  std::printf("testing %zu MiB per round count, aes with %u bit key\n",
+              options->megabytes,
+              options->key_bits);
+  std::optional<std::size_t> cheapest;
+  double cheapest_speed = 0;
+  for (std::size_t rounds = 1; rounds <= max_rounds; ++rounds) {
+    const auto outcome =
+      evaluate(make_cipher(options->key_bits, rounds), *options);
+    const bool passed = TestBattery::passed(outcome.results, options->alpha);
+    std::printf("rounds %2zu  %7.3f GB/s  %s ",
+                rounds,
+                outcome.bytes_per_second * 1e-9,
+                passed ? "pass" : "FAIL");
+    print_results(outcome.results, stdout);
+    if (passed && !cheapest) {
+      cheapest = rounds;
+      cheapest_speed = outcome.bytes_per_second;
+    }
+  }
+  if (cheapest) {
+    std::printf("fewest rounds passing: %zu, at %.3f GB/s\n",
+                *cheapest,
+                cheapest_speed * 1e-9);
+  } else {
+    std::printf("no round count passed\n");
+  }
+}
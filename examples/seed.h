@@ -0,0 +1,35 @@
+#pragma once
+
+// seeding of the lfsr state, shared by the command line tools
+
+#include <cstddef>
+#include <cstdint>
+
+inline std::uint64_t
+splitmix64(std::uint64_t& state)
+{
+  std::uint64_t z = (state += 0x9e3779b97f4a7c15);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+  return z ^ (z >> 31);
+}
+
+/// fills the state (a BigNum) with bits derived from the seed, with
+/// splitmix64. the state is never all zeros.
+template<typename State>
+State
+seeded_state(std::uint64_t seed)
+{
+  State state;
+  std::uint64_t bits = 0;
+  for (std::size_t i = 0; i < state.bitcount(); ++i) {
+    if (i % 64 == 0) {
+      bits = splitmix64(seed);
+    }
+    state.set_bit_to(i, (bits >> (i % 64)) & 1);
+  }
+  if (state == State{}) {
+    state.set_bit_to(0, true);
+  }
+  return state;
+}
@@ -0,0 +1,317 @@
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/fs.h>
+#endif
+
+#include <tiptap/lfsr_big.h>
+
+#include "seed.h"
+
+// writes a deterministic lfsr pattern to a file or block device, and
+// verifies it. byte i of the device is byte i of the lfsr output, so a block
+// can be regenerated on its own by jumping to its offset, and the pattern
+// never needs to be stored.
+//
+// the file is opened with O_DIRECT, bypassing the page cache, so that verify
+// reads what is on the device. several blocks are in flight at once, one per
+// thread, each thread generating the pattern for its block and doing the
+// blocking pwrite/pread.
+//
+// usage: tiptap-pattern write|verify PATH [--size BYTES] [--block-kib K]
+//                       [--queue-depth Q] [--seed S]
+
+namespace {
+
+using LFSR = BigLFSR<128, std::uint64_t>;
+
+/// O_DIRECT needs the buffers, offsets and sizes aligned to the logical block
+/// size of the device, 4096 covers all common devices
+constexpr std::size_t alignment = 4096;
+
+struct Options
+{
+  bool write = false;
+  std::string path;
+  /// zero means the size of the existing file or device
+  std::uint64_t size = 0;
+  std::size_t block_kib = 1024;
+  unsigned queue_depth = std::max(std::thread::hardware_concurrency(), 1U);
+  std::uint64_t seed = 0;
+};
+
+std::optional<Options>
+parse(int argc, char* argv[])
+{
+  if (argc < 3 || argc % 2 == 0) {
+    return std::nullopt;
+  }
+  Options options;
+  const std::string mode = argv[1];
+  if (mode != "write" && mode != "verify") {
+    return std::nullopt;
+  }
+  options.write = mode == "write";
+  options.path = argv[2];
+  for (int i = 3; i + 1 < argc; i += 2) {
+    const std::string flag = argv[i];
+    const char* value = argv[i + 1];
+    if (flag == "--size") {
+      options.size = std::strtoull(value, nullptr, 0);
+    } else if (flag == "--block-kib") {
+      options.block_kib = std::strtoull(value, nullptr, 10);
+    } else if (flag == "--queue-depth") {
+      options.queue_depth = static_cast<unsigned>(std::atoi(value));
+    } else if (flag == "--seed") {
+      options.seed = std::strtoull(value, nullptr, 0);
+    } else {
+      return std::nullopt;
+    }
+  }
+  if (options.block_kib == 0 || (options.block_kib * 1024) % alignment != 0 ||
+      options.queue_depth == 0) {
+    return std::nullopt;
+  }
+  return options;
+}
+
+bool
+is_regular_file(int fd)
+{
+  struct stat st;
+  return fstat(fd, &st) == 0 && S_ISREG(st.st_mode);
+}
+
+/// the size of a regular file or a block device
+std::uint64_t
+device_size(int fd)
+{
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    return 0;
+  }
+#ifdef __linux__
+  if (S_ISBLK(st.st_mode)) {
+    std::uint64_t size = 0;
+    return ioctl(fd, BLKGETSIZE64, &size) == 0 ? size : 0;
+  }
+#endif
+  return static_cast<std::uint64_t>(st.st_size);
+}
+
+int
+open_direct(const Options& options)
+{
+  int flags = options.write ? O_WRONLY | O_CREAT : O_RDONLY;
+  int fd = ::open(options.path.c_str(), flags | O_DIRECT, 0644);
+  if (fd < 0 && errno == EINVAL) {
+    // some file systems, like tmpfs, do not support O_DIRECT
+    std::fprintf(stderr,
+                 "%s does not support O_DIRECT, continuing without it. "
+                 "verification may read from the page cache.\n",
+                 options.path.c_str());
+    fd = ::open(options.path.c_str(), flags, 0644);
+  }
+  return fd;
+}
+
+struct AlignedFree
+{
+  void operator()(std::byte* p) const { std::free(p); }
+};
+using Buffer = std::unique_ptr<std::byte[], AlignedFree>;
+
+Buffer
+make_buffer(std::size_t size)
+{
+  return Buffer(static_cast<std::byte*>(std::aligned_alloc(alignment, size)));
+}
+
+struct Mismatch
+{
+  /// the offset of the first differing byte
+  std::uint64_t offset;
+  /// the number of differing bytes in the block
+  std::uint64_t count;
+};
+
+/// the pattern at offset, out.size() bytes
+void
+generate_at(const LFSR& start, std::uint64_t offset, std::span<std::byte> out)
+{
+  LFSR lfsr = start;
+  lfsr.jump(offset * 8);
+  lfsr.generate(out);
+}
+
+std::optional<Mismatch>
+compare(std::span<const std::byte> actual,
+        std::span<const std::byte> expected,
+        std::uint64_t offset)
+{
+  if (std::memcmp(actual.data(), expected.data(), actual.size()) == 0) {
+    return std::nullopt;
+  }
+  Mismatch m{ ~std::uint64_t{}, 0 };
+  for (std::size_t i = 0; i < actual.size(); ++i) {
+    if (actual[i] != expected[i]) {
+      m.offset = std::min(m.offset, offset + i);
+      ++m.count;
+    }
+  }
+  return m;
+}
+}
+
+int
+main(int argc, char* argv[])
+{
+  const auto options = parse(argc, argv);
+  if (!options) {
+    std::fprintf(stderr,
+                 "usage: %s write|verify PATH [--size BYTES] [--block-kib K] "
+                 "[--queue-depth Q] [--seed S]\n"
+                 "  K must be a multiple of 4. the size is rounded down to a "
+                 "multiple of 4096.\n",
+                 argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  // the buffers of the workers, allocated before touching the file
+  const std::size_t blocksize = options->block_kib * 1024;
+  std::vector<Buffer> buffers;
+  std::vector<Buffer> expected_buffers;
+  for (unsigned i = 0; i < options->queue_depth; ++i) {
+    buffers.push_back(make_buffer(blocksize));
+    expected_buffers.push_back(options->write ? nullptr
+                                              : make_buffer(blocksize));
+    if (!buffers.back() || (!options->write && !expected_buffers.back())) {
+      std::fprintf(stderr,
+                   "could not allocate buffers of %zu bytes, try a smaller "
+                   "--block-kib or --queue-depth\n",
+                   blocksize);
+      return EXIT_FAILURE;
+    }
+  }
+
+  const int fd = open_direct(*options);
+  if (fd < 0) {
+    std::perror(options->path.c_str());
+    return EXIT_FAILURE;
+  }
+  std::uint64_t size = options->size != 0 ? options->size : device_size(fd);
+  size -= size % alignment;
+  if (size == 0) {
+    std::fprintf(stderr, "nothing to do, give the size with --size\n");
+    ::close(fd);
+    return EXIT_FAILURE;
+  }
+  // a longer file would keep an old tail, which a later verify without
+  // --size would read as mismatches
+  if (options->write && is_regular_file(fd) &&
+      ::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+    std::perror("ftruncate");
+    ::close(fd);
+    return EXIT_FAILURE;
+  }
+
+  const LFSR start(seeded_state<decltype(LFSR{}.state())>(options->seed));
+  const std::uint64_t nblocks = (size + blocksize - 1) / blocksize;
+
+  std::atomic<std::uint64_t> next_block{ 0 };
+  std::atomic<bool> io_error{ false };
+  std::mutex mutex;
+  std::vector<Mismatch> mismatches;
+
+  const auto before = std::chrono::steady_clock::now();
+  auto worker = [&](unsigned index) {
+    const auto& buffer = buffers[index];
+    const auto& expected = expected_buffers[index];
+    for (;;) {
+      const std::uint64_t block = next_block.fetch_add(1);
+      if (block >= nblocks || io_error) {
+        return;
+      }
+      const std::uint64_t offset = block * blocksize;
+      const auto n = static_cast<std::size_t>(
+        std::min<std::uint64_t>(blocksize, size - offset));
+      const std::span data(buffer.get(), n);
+      if (options->write) {
+        generate_at(start, offset, data);
+        if (::pwrite(fd, data.data(), n, static_cast<off_t>(offset)) !=
+            static_cast<ssize_t>(n)) {
+          io_error = true;
+          std::perror("pwrite");
+        }
+      } else {
+        if (::pread(fd, data.data(), n, static_cast<off_t>(offset)) !=
+            static_cast<ssize_t>(n)) {
+          io_error = true;
+          std::perror("pread");
+          return;
+        }
+        const std::span reference(expected.get(), n);
+        generate_at(start, offset, reference);
+        if (const auto m = compare(data, reference, offset)) {
+          std::lock_guard lock(mutex);
+          mismatches.push_back(*m);
+        }
+      }
+    }
+  };
+  {
+    std::vector<std::jthread> threads;
+    for (unsigned i = 0; i < options->queue_depth; ++i) {
+      threads.emplace_back(worker, i);
+    }
+  }
+  if (options->write && ::fsync(fd) != 0) {
+    std::perror("fsync");
+    io_error = true;
+  }
+  ::close(fd);
+  const std::chrono::duration<double> elapsed =
+    std::chrono::steady_clock::now() - before;
+
+  std::sort(mismatches.begin(),
+            mismatches.end(),
+            [](const Mismatch& a, const Mismatch& b) {
+              return a.offset < b.offset;
+            });
+  constexpr std::size_t max_reported = 100;
+  for (std::size_t i = 0; i < std::min(mismatches.size(), max_reported); ++i) {
+    std::printf("mismatch at offset %llu, %llu bytes differ in the block\n",
+                static_cast<unsigned long long>(mismatches[i].offset),
+                static_cast<unsigned long long>(mismatches[i].count));
+  }
+  if (mismatches.size() > max_reported) {
+    std::printf("... and %zu more blocks with mismatches\n",
+                mismatches.size() - max_reported);
+  }
+  std::fprintf(stderr,
+               "%s %llu bytes in %.2f s, %.1f MB/s%s\n",
+               options->write ? "wrote" : "verified",
+               static_cast<unsigned long long>(size),
+               elapsed.count(),
+               static_cast<double>(size) / elapsed.count() * 1e-6,
+               io_error ? ", with io errors" : "");
+  return io_error || !mismatches.empty() ? EXIT_FAILURE : EXIT_SUCCESS;
+}
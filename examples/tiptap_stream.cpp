@@ -0,0 +1,326 @@
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <semaphore>
+#include <span>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/uio.h>
+#endif
+
+#include <tiptap/lfsr_big.h>
+#include <tiptap/parallel.h>
+
+#include "seed.h"
+#if HAVE_AES
+#include <tiptap/encrypted_counter.h>
+constexpr bool have_aes = true;
+#else
+constexpr bool have_aes = false;
+#endif
+
+// writes the raw output of a generator to stdout, for piping into PractRand,
+// dieharder and similar tools which read from stdin. a producer thread fills
+// large blocks while the previous ones are written. when stdout is a pipe on
+// linux, the blocks are handed over with vmsplice instead of being copied.
+//
+// usage: tiptap-stream [--type big|aes] [--n N] [--seed S] [--offset K]
+//                      [--rounds R] [--bytes B] [--threads T]
+//                      [--block-mib M]
+//
+// the lfsr is bit serial, so unless there are many cores (see --threads) the
+// aes based generator is the one which fills a pipe at several GB/s.
+
+namespace {
+
+struct Options
+{
+  std::string type = "big";
+  std::size_t n = 64;
+  std::optional<std::uint64_t> seed;
+  std::uint64_t offset = 0;
+  std::size_t rounds = 9;
+  /// zero means no limit
+  std::uint64_t bytes = 0;
+  unsigned threads = std::max(std::thread::hardware_concurrency(), 1U);
+  std::size_t block_mib = 4;
+};
+
+std::optional<Options>
+parse(int argc, char* argv[])
+{
+  Options options;
+  if (argc % 2 == 0) {
+    return std::nullopt;
+  }
+  for (int i = 1; i + 1 < argc; i += 2) {
+    const std::string flag = argv[i];
+    const char* value = argv[i + 1];
+    if (flag == "--type") {
+      options.type = value;
+    } else if (flag == "--n") {
+      options.n = std::strtoull(value, nullptr, 10);
+    } else if (flag == "--seed") {
+      options.seed = std::strtoull(value, nullptr, 0);
+    } else if (flag == "--offset") {
+      options.offset = std::strtoull(value, nullptr, 0);
+    } else if (flag == "--rounds") {
+      options.rounds = std::strtoull(value, nullptr, 10);
+    } else if (flag == "--bytes") {
+      options.bytes = std::strtoull(value, nullptr, 0);
+    } else if (flag == "--threads") {
+      options.threads = static_cast<unsigned>(std::atoi(value));
+    } else if (flag == "--block-mib") {
+      options.block_mib = std::strtoull(value, nullptr, 10);
+    } else {
+      return std::nullopt;
+    }
+  }
+  if (options.threads == 0 || options.block_mib == 0) {
+    return std::nullopt;
+  }
+  return options;
+}
+
+using Fill = std::function<void(std::span<std::byte>)>;
+
+template<std::size_t N>
+Fill
+make_lfsr(const Options& options)
+{
+  using LFSR = BigLFSR<N, std::uint64_t>;
+  LFSR lfsr;
+  if (options.seed) {
+    lfsr = LFSR(seeded_state<decltype(lfsr.state())>(*options.seed));
+  }
+  lfsr.jump(options.offset);
+  return [lfsr, threads = options.threads](std::span<std::byte> out) mutable {
+    parallel_generate(lfsr, out, threads);
+  };
+}
+
+/// the sizes which can be selected at runtime
+using Sizes = std::index_sequence<8,
+                                  16,
+                                  24,
+                                  32,
+                                  48,
+                                  64,
+                                  96,
+                                  128,
+                                  168,
+                                  512,
+                                  768,
+                                  1024,
+                                  2048,
+                                  4096>;
+
+template<std::size_t... N>
+std::optional<Fill>
+make_lfsr(const Options& options, std::index_sequence<N...>)
+{
+  std::optional<Fill> ret;
+  ((options.n == N ? (ret = make_lfsr<N>(options), 0) : 0), ...);
+  return ret;
+}
+
+std::optional<Fill>
+make_generator(const Options& options)
+{
+  if (options.type == "big") {
+    return make_lfsr(options, Sizes{});
+  }
+#if HAVE_AES
+  if (options.type == "aes" && options.rounds >= 1 &&
+      options.rounds <= Aes::MaxRounds128) {
+    EncryptedCounter::Counter counter;
+    if (options.seed) {
+      counter = EncryptedCounter::Counter(
+        seeded_state<decltype(counter.state())>(*options.seed));
+    }
+    counter.jump(options.offset);
+    EncryptedCounter generator(
+      Aes("000102030405060708090a0b0c0d0e0f"_128bithex, options.rounds),
+      counter);
+    return [generator](std::span<std::byte> out) mutable {
+      generator.generate(out);
+    };
+  }
+#endif
+  return std::nullopt;
+}
+
+/// writes everything, returns false if the reader went away or on error
+bool
+write_all(int fd, std::span<const std::byte> data)
+{
+  while (!data.empty()) {
+    const auto written = ::write(fd, data.data(), data.size());
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    data = data.subspan(static_cast<std::size_t>(written));
+  }
+  return true;
+}
+
+#ifdef __linux__
+/// like write_all, but lets the pipe refer to the pages of data instead of
+/// copying them. the caller must not modify data until at least a pipe
+/// capacity worth of later data has been spliced.
+bool
+splice_all(int fd, std::span<const std::byte> data)
+{
+  while (!data.empty()) {
+    iovec iov{ const_cast<std::byte*>(data.data()), data.size() };
+    const auto written = ::vmsplice(fd, &iov, 1, 0);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    data = data.subspan(static_cast<std::size_t>(written));
+  }
+  return true;
+}
+#endif
+
+/// true if the blocks can be given to the pipe with vmsplice. tries to make
+/// the pipe as large as the blocks, since that means fewer context switches.
+bool
+prepare_splice(int fd, std::size_t blocksize)
+{
+#ifdef __linux__
+  struct stat st;
+  if (fstat(fd, &st) != 0 || !S_ISFIFO(st.st_mode)) {
+    return false;
+  }
+  fcntl(fd, F_SETPIPE_SZ, static_cast<int>(std::min<std::size_t>(
+                            blocksize, std::size_t{ 1 } << 20)));
+  const int pipesize = fcntl(fd, F_GETPIPE_SZ);
+  // see splice_all: a whole block must be able to push the previous one out
+  // of the pipe
+  return pipesize > 0 && static_cast<std::size_t>(pipesize) <= blocksize;
+#else
+  (void)fd;
+  (void)blocksize;
+  return false;
+#endif
+}
+}
+
+int
+main(int argc, char* argv[])
+{
+  const auto options = parse(argc, argv);
+  std::optional<Fill> fill;
+  if (options) {
+    fill = make_generator(*options);
+  }
+  if (!fill) {
+    std::fprintf(stderr,
+                 "usage: %s [--type big|aes] [--n N] [--seed S] [--offset K] "
+                 "[--rounds R] [--bytes B] [--threads T] [--block-mib M]\n"
+                 "  --type big is BigLFSR<N>, with N one of",
+                 argv[0]);
+    [&]<std::size_t... N>(std::index_sequence<N...>) {
+      ((std::fprintf(stderr, " %zu", N)), ...);
+    }(Sizes{});
+    std::fprintf(stderr,
+                 "\n  --type aes is the aes encrypted 128 bit lfsr counter, "
+                 "with 1 to 9 rounds%s\n",
+                 have_aes ? "" : " (not available in this build)");
+    return EXIT_FAILURE;
+  }
+
+  // a closed pipe should end the program with an error from write, not a
+  // signal
+  std::signal(SIGPIPE, SIG_IGN);
+
+  const std::size_t blocksize = options->block_mib << 20;
+  const bool use_splice = prepare_splice(STDOUT_FILENO, blocksize);
+
+  // the producer fills the blocks in turn. with vmsplice a block is in use
+  // until the block after it has been written, so three blocks are needed to
+  // keep the producer busy while writing. with write two would be enough.
+  constexpr std::size_t nblocks = 3;
+  std::vector<std::vector<std::byte>> blocks(
+    nblocks, std::vector<std::byte>(blocksize));
+  std::vector<std::size_t> filled(nblocks);
+  // one more than the blocks, for waking up the producer when stopping
+  std::counting_semaphore<nblocks + 1> free_blocks(nblocks);
+  std::counting_semaphore<nblocks + 1> ready_blocks(0);
+  std::atomic<bool> stop{ false };
+
+  std::jthread producer([&]() {
+    std::uint64_t remaining = options->bytes;
+    for (std::size_t i = 0;; ++i) {
+      free_blocks.acquire();
+      auto& block = blocks[i % nblocks];
+      std::size_t size = block.size();
+      if (options->bytes != 0) {
+        size =
+          static_cast<std::size_t>(std::min<std::uint64_t>(size, remaining));
+        remaining -= size;
+      }
+      if (stop) {
+        size = 0;
+      }
+      (*fill)(std::span(block).first(size));
+      filled[i % nblocks] = size;
+      ready_blocks.release();
+      if (size == 0) {
+        return;
+      }
+    }
+  });
+
+  bool ok = true;
+  bool reader_gone = false;
+  for (std::size_t i = 0;; ++i) {
+    ready_blocks.acquire();
+    const auto& block = blocks[i % nblocks];
+    const auto size = filled[i % nblocks];
+    if (size == 0) {
+      break;
+    }
+    const std::span data(block.data(), size);
+#ifdef __linux__
+    ok = use_splice ? splice_all(STDOUT_FILENO, data)
+                    : write_all(STDOUT_FILENO, data);
+#else
+    ok = write_all(STDOUT_FILENO, data);
+#endif
+    if (!ok) {
+      reader_gone = errno == EPIPE;
+      // let the producer see stop and finish
+      stop = true;
+      free_blocks.release();
+      break;
+    }
+    // with vmsplice, the previous block is now out of the pipe
+    if (!use_splice || i > 0) {
+      free_blocks.release();
+    }
+  }
+  producer.join();
+  return ok || reader_gone ? EXIT_SUCCESS : EXIT_FAILURE;
+}
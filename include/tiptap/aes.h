@@ -0,0 +1,236 @@
+#pragma once
+
+// aes encryption using the AES-NI instructions. this header needs a compiler
+// and target with AES-NI enabled (for instance -maes or -march=native), the
+// build checks for it with HAS_AES_INTRINSICS.
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+#include <wmmintrin.h> //for intrinsics for AES-NI
+
+constexpr std::array<std::uint8_t, 16> operator""_128bithex(const char* str,
+                                                            std::size_t length)
+{
+  assert(length == 32);
+  std::array<std::uint8_t, 16> parsed;
+  auto get_nibble = [](const char c) {
+    if (c >= 'a' && c <= 'f') {
+      return (c - 'a') + 0xA;
+    }
+    if (c >= 'A' && c <= 'F') {
+      return (c - 'A') + 0xA;
+    }
+    if (c >= '0' && c <= '9') {
+      return (c - '0');
+    }
+    throw "not a hex char";
+  };
+  for (int i = 0; i < 16; ++i) {
+    parsed[i] = (get_nibble(str[2 * i]) << 4) | get_nibble(str[2 * i + 1]);
+  }
+  return parsed;
+}
+
+inline __m128i
+to_128bit_register(const std::array<std::uint8_t, 16>& x)
+{
+  __m128i ret = _mm_loadu_si128((const __m128i*)x.data());
+  return ret;
+}
+
+/**
+ * a fixed number of 128 bit registers. std::array<__m128i, K> would drop the
+ * vector attributes of __m128i from the template argument, which gcc warns
+ * about.
+ */
+template<std::size_t K>
+struct M128Array
+{
+  static constexpr std::size_t size() { return K; }
+
+  __m128i& operator[](std::size_t i) { return m_data[i]; }
+  const __m128i& operator[](std::size_t i) const { return m_data[i]; }
+
+  __m128i* begin() { return m_data; }
+  __m128i* end() { return m_data + K; }
+  const __m128i* begin() const { return m_data; }
+  const __m128i* end() const { return m_data + K; }
+
+  void fill(__m128i value)
+  {
+    for (auto& x : m_data) {
+      x = value;
+    }
+  }
+
+  __m128i m_data[K];
+};
+
+namespace detail {
+/// xors each 32 bit word of key with all the words below it, then with the
+/// word of assist selected by Shuffle. this is the common part of the key
+/// expansion steps.
+template<int Shuffle>
+inline __m128i
+aes_expand_step(__m128i key, __m128i assist)
+{
+  assist = _mm_shuffle_epi32(assist, Shuffle);
+  key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+  key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+  key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+  return _mm_xor_si128(key, assist);
+}
+
+/// the AES-128 key schedule, 11 round keys
+inline M128Array<11>
+aes128_expand_key(__m128i key)
+{
+  M128Array<11> k;
+  k[0] = key;
+  // aeskeygenassist needs the round constant as an immediate
+  k[1] = aes_expand_step<0xff>(k[0], _mm_aeskeygenassist_si128(k[0], 0x01));
+  k[2] = aes_expand_step<0xff>(k[1], _mm_aeskeygenassist_si128(k[1], 0x02));
+  k[3] = aes_expand_step<0xff>(k[2], _mm_aeskeygenassist_si128(k[2], 0x04));
+  k[4] = aes_expand_step<0xff>(k[3], _mm_aeskeygenassist_si128(k[3], 0x08));
+  k[5] = aes_expand_step<0xff>(k[4], _mm_aeskeygenassist_si128(k[4], 0x10));
+  k[6] = aes_expand_step<0xff>(k[5], _mm_aeskeygenassist_si128(k[5], 0x20));
+  k[7] = aes_expand_step<0xff>(k[6], _mm_aeskeygenassist_si128(k[6], 0x40));
+  k[8] = aes_expand_step<0xff>(k[7], _mm_aeskeygenassist_si128(k[7], 0x80));
+  k[9] = aes_expand_step<0xff>(k[8], _mm_aeskeygenassist_si128(k[8], 0x1b));
+  k[10] = aes_expand_step<0xff>(k[9], _mm_aeskeygenassist_si128(k[9], 0x36));
+  return k;
+}
+
+/// one round constant of the AES-256 key schedule, which gives the round
+/// keys at index i and i+1
+template<int Rcon>
+inline void
+aes256_expand_pair(M128Array<15>& k, std::size_t i)
+{
+  k[i] = aes_expand_step<0xff>(k[i - 2],
+                               _mm_aeskeygenassist_si128(k[i - 1], Rcon));
+  if (i + 1 < k.size()) {
+    k[i + 1] = aes_expand_step<0xaa>(k[i - 1],
+                                     _mm_aeskeygenassist_si128(k[i], 0x00));
+  }
+}
+
+/// the AES-256 key schedule, 15 round keys
+inline M128Array<15>
+aes256_expand_key(__m128i low, __m128i high)
+{
+  M128Array<15> k;
+  k[0] = low;
+  k[1] = high;
+  aes256_expand_pair<0x01>(k, 2);
+  aes256_expand_pair<0x02>(k, 4);
+  aes256_expand_pair<0x04>(k, 6);
+  aes256_expand_pair<0x08>(k, 8);
+  aes256_expand_pair<0x10>(k, 10);
+  aes256_expand_pair<0x20>(k, 12);
+  aes256_expand_pair<0x40>(k, 14);
+  return k;
+}
+} // namespace detail
+
+/**
+ * AES encryption with the key expanded at runtime, and a configurable number
+ * of intermediate rounds. the standard number of intermediate rounds is 9 for
+ * a 128 bit key and 13 for a 256 bit key. fewer rounds are meant for
+ * experimenting with how much of the cipher is needed, see
+ * examples/roundsweep.cpp.
+ */
+class Aes
+{
+public:
+  using SixteenByte = std::array<std::uint8_t, 16>;
+  using ThirtyTwoByte = std::array<std::uint8_t, 32>;
+  static constexpr std::size_t MaxRounds128 = 9;
+  static constexpr std::size_t MaxRounds256 = 13;
+
+  /// the key from the AES-128 example in FIPS-197, with 9 rounds
+  Aes()
+    : Aes("000102030405060708090a0b0c0d0e0f"_128bithex)
+  {
+  }
+
+  /// a 128 bit key, rounds must be 1..9
+  explicit Aes(const SixteenByte& key, std::size_t rounds = MaxRounds128)
+    : m_rounds(rounds)
+  {
+    assert(rounds >= 1 && rounds <= MaxRounds128);
+    const auto expanded = detail::aes128_expand_key(to_128bit_register(key));
+    for (std::size_t i = 0; i < expanded.size(); ++i) {
+      m_expanded_keys[i] = expanded[i];
+    }
+  }
+
+  /// a 256 bit key, rounds must be 1..13
+  explicit Aes(const ThirtyTwoByte& key, std::size_t rounds = MaxRounds256)
+    : m_rounds(rounds)
+  {
+    assert(rounds >= 1 && rounds <= MaxRounds256);
+    m_expanded_keys = detail::aes256_expand_key(
+      _mm_loadu_si128((const __m128i*)key.data()),
+      _mm_loadu_si128((const __m128i*)(key.data() + 16)));
+  }
+
+  /// the number of intermediate rounds
+  std::size_t rounds() const { return m_rounds; }
+
+  /// round key i, 0 <= i <= rounds()+1
+  __m128i round_key(std::size_t i) const
+  {
+    assert(i <= m_rounds + 1);
+    return m_expanded_keys[i];
+  }
+
+  __m128i encrypt(__m128i m) const
+  {
+    // initial round
+    m = _mm_xor_si128(m, m_expanded_keys[0]);
+
+    // intermediate rounds (use one-based indexing)
+    for (std::size_t round = 1; round <= m_rounds; ++round) {
+      m = _mm_aesenc_si128(m, m_expanded_keys[round]);
+    }
+    // last round
+    m = _mm_aesenclast_si128(m, m_expanded_keys[m_rounds + 1]);
+    return m;
+  }
+
+  /// encrypts the blocks in place. the rounds are interleaved over the
+  /// blocks, so there are K independent aesenc in flight instead of each one
+  /// waiting for the result of the previous.
+  template<std::size_t K>
+  void encrypt(M128Array<K>& blocks) const
+  {
+    for (auto& block : blocks) {
+      block = _mm_xor_si128(block, m_expanded_keys[0]);
+    }
+    for (std::size_t round = 1; round <= m_rounds; ++round) {
+      const auto key = m_expanded_keys[round];
+      for (auto& block : blocks) {
+        block = _mm_aesenc_si128(block, key);
+      }
+    }
+    for (auto& block : blocks) {
+      block = _mm_aesenclast_si128(block, m_expanded_keys[m_rounds + 1]);
+    }
+  }
+
+  SixteenByte encrypt(const SixteenByte& x) const
+  {
+    SixteenByte ret;
+    const auto m = encrypt(to_128bit_register(x));
+    _mm_storeu_si128((__m128i*)ret.data(), m);
+    return ret;
+  }
+
+private:
+  M128Array<MaxRounds256 + 2> m_expanded_keys{};
+  std::size_t m_rounds;
+};
@@ -1,12 +1,18 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <bit>
 #include <cassert>
 #include <cstdint>
 #include <limits>
+#include <type_traits>
 #include <utility>
 
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
 namespace detail {
 template<std::size_t current_bit_index,
          std::size_t desired_bit_index,
@@ -22,6 +28,129 @@ signed_shift(Limb x)
     return x;
   }
 }
+
+// simd kernels for shifting large states right one bit, for states of a
+// multiple of 512 bits which BigNum aligns to 64 bytes. each vector of limbs
+// is combined with the vector of the limbs one above it, which is made from
+// two aligned loads with a lane shift. unaligned loads would read across the
+// stores of the previous step, which defeats store forwarding and makes the
+// kernel several times slower.
+#if defined(__AVX512F__)
+inline constexpr std::size_t simd_shift_bytes = 64;
+
+template<typename Limb>
+inline __m512i
+shr_one_bit_vector(__m512i lo, __m512i next)
+{
+  if constexpr (sizeof(Limb) == 8) {
+    // the maskz forms here and in the shifts below, as the plain ones warn
+    // about an uninitialized value in the gcc 12 headers
+    const __m512i hi = _mm512_maskz_alignr_epi64(0xff, next, lo, 1);
+#if defined(__AVX512VBMI2__)
+    // vpshrdq, a funnel shift of each pair of lanes
+    return _mm512_shrdi_epi64(lo, hi, 1);
+#else
+    return _mm512_or_si512(_mm512_maskz_srli_epi64(0xff, lo, 1),
+                           _mm512_maskz_slli_epi64(0xff, hi, 63));
+#endif
+  } else {
+    const __m512i hi = _mm512_maskz_alignr_epi32(0xffff, next, lo, 1);
+#if defined(__AVX512VBMI2__)
+    return _mm512_shrdi_epi32(lo, hi, 1);
+#else
+    return _mm512_or_si512(_mm512_maskz_srli_epi32(0xffff, lo, 1),
+                           _mm512_maskz_slli_epi32(0xffff, hi, 31));
+#endif
+  }
+}
+
+template<typename Limb, std::size_t Count>
+inline void
+shr_one_bit_simd(Limb* data, Limb top_bit)
+{
+  constexpr std::size_t PerVector = simd_shift_bytes / sizeof(Limb);
+  __m512i lo = _mm512_load_si512(data);
+  for (std::size_t i = 0; i + PerVector < Count; i += PerVector) {
+    const __m512i next = _mm512_load_si512(data + i + PerVector);
+    _mm512_store_si512(data + i, shr_one_bit_vector<Limb>(lo, next));
+    lo = next;
+  }
+  // the top bit goes in the last lane, already in position
+  const __m512i top = sizeof(Limb) == 8
+                        ? _mm512_maskz_set1_epi64(0x80, top_bit)
+                        : _mm512_maskz_set1_epi32(0x8000, top_bit);
+  _mm512_store_si512(data + Count - PerVector,
+                     _mm512_or_si512(shr_one_bit_vector<Limb>(
+                                       lo, _mm512_setzero_si512()),
+                                     top));
+}
+#elif defined(__AVX2__)
+inline constexpr std::size_t simd_shift_bytes = 32;
+
+template<typename Limb>
+inline __m256i
+shr_one_bit_vector(__m256i lo, __m256i next)
+{
+  // the limbs one above lo. alignr works within 128 bit lanes, so the lanes
+  // are first lined up with a permute.
+  const __m256i upper = _mm256_permute2x128_si256(lo, next, 0x21);
+  const __m256i hi = _mm256_alignr_epi8(upper, lo, sizeof(Limb));
+  if constexpr (sizeof(Limb) == 8) {
+    return _mm256_or_si256(_mm256_srli_epi64(lo, 1), _mm256_slli_epi64(hi, 63));
+  } else {
+    return _mm256_or_si256(_mm256_srli_epi32(lo, 1), _mm256_slli_epi32(hi, 31));
+  }
+}
+
+template<typename Limb, std::size_t Count>
+inline void
+shr_one_bit_simd(Limb* data, Limb top_bit)
+{
+  constexpr std::size_t PerVector = simd_shift_bytes / sizeof(Limb);
+  auto* vectors = reinterpret_cast<__m256i*>(data);
+  constexpr std::size_t VectorCount = Count / PerVector;
+  __m256i lo = _mm256_load_si256(vectors);
+  for (std::size_t i = 0; i + 1 < VectorCount; ++i) {
+    const __m256i next = _mm256_load_si256(vectors + i + 1);
+    _mm256_store_si256(vectors + i, shr_one_bit_vector<Limb>(lo, next));
+    lo = next;
+  }
+  // the top bit goes in the last lane, already in position
+  const __m256i top =
+    sizeof(Limb) == 8
+      ? _mm256_set_epi64x(static_cast<long long>(top_bit), 0, 0, 0)
+      : _mm256_set_epi32(static_cast<int>(top_bit), 0, 0, 0, 0, 0, 0, 0);
+  _mm256_store_si256(
+    vectors + VectorCount - 1,
+    _mm256_or_si256(shr_one_bit_vector<Limb>(lo, _mm256_setzero_si256()),
+                    top));
+}
+#else
+inline constexpr std::size_t simd_shift_bytes = 0;
+
+/// not used, there is no simd shift for this target
+template<typename Limb, std::size_t Count>
+inline void
+shr_one_bit_simd(Limb*, Limb)
+{
+}
+#endif
+
+/// the alignment of the limbs of a bignum of Bytes bytes
+template<std::size_t Bytes, std::size_t LimbAlignment>
+inline constexpr std::size_t bignum_alignment =
+  Bytes >= 64 ? 64 : LimbAlignment;
+
+/// the 64 bits starting at bit offset of lo, continuing into hi. this is
+/// BigNum::extract<64> for two 64 bit words, for code which keeps bit
+/// sequences in plain arrays of words.
+constexpr std::uint64_t
+funnel_shift(std::uint64_t lo, std::uint64_t hi, unsigned offset)
+{
+  assert(offset < 64);
+  // shifting twice avoids shifting by 64 when offset is zero
+  return (lo >> offset) | ((hi << 1) << (63 - offset));
+}
 }
 
 /**
@@ -36,6 +165,13 @@ struct BigNum
   static inline constexpr int LimbCount =
     (Nbits + (BitsPerLimb - 1)) / BitsPerLimb;
   static inline constexpr int ExcessBits = LimbCount * BitsPerLimb - Nbits;
+  /// whether shr_one_bit uses the simd kernels, outside of constant
+  /// evaluation. they need whole 512 bit blocks of 32 or 64 bit limbs, and
+  /// up to 8 limbs the scalar loop is as fast.
+  static inline constexpr bool UseSimdShift =
+    detail::simd_shift_bytes > 0 && std::is_unsigned_v<Limb> &&
+    (sizeof(Limb) == 4 || sizeof(Limb) == 8) && LimbCount > 8 &&
+    LimbCount * sizeof(Limb) % 64 == 0;
 
   template<std::size_t... bits>
   constexpr int parity(std::index_sequence<bits...>) const
@@ -83,7 +219,7 @@ struct BigNum
     assert(bit <= Nbits);
     const auto limb = bit / BitsPerLimb;
     const auto bitwithinlimb = bit - (bit / BitsPerLimb) * BitsPerLimb;
-    const auto limbmask = 1U << bitwithinlimb;
+    const auto limbmask = Limb{ 1 } << bitwithinlimb;
     return (m_data[limb] & limbmask);
   }
 
@@ -117,6 +253,12 @@ struct BigNum
     for (auto& d : m_data) {
       d = ~d;
     }
+    clear_excess_bits();
+  }
+
+  // zeros the bits above the top, in the last limb
+  constexpr void clear_excess_bits()
+  {
     if constexpr (ExcessBits > 0) {
       constexpr Limb mask = (Limb{ 1U } << (BitsPerLimb - ExcessBits)) - 1U;
       m_data.back() &= mask;
@@ -127,21 +269,20 @@ struct BigNum
   // (default zero/false)
   constexpr void shr_one_bit(bool top_bit = false)
   {
-    for (std::size_t i = 0; i < m_data.size(); ++i) {
-      m_data[i] >>= 1;
-      if (i + 1 < m_data.size()) {
-        // get the top bit from the bottom bit of the next limb
-        m_data[i] |= (m_data[i + 1] << (BitsPerLimb - 1));
-      } else {
-        m_data[i] |= (Limb{ top_bit } << (BitsPerLimb - ExcessBits - 1));
-      }
-    }
+    shr_one_bit(
+      static_cast<Limb>(Limb{ top_bit } << (BitsPerLimb - ExcessBits - 1)));
   }
 
   // right shifts one bit, puts the given top_bit into the topmost bit. note
   // that top_bit should have it's correct position already.
   constexpr void shr_one_bit(Limb top_bit)
   {
+    if constexpr (UseSimdShift) {
+      if (!std::is_constant_evaluated()) {
+        detail::shr_one_bit_simd<Limb, LimbCount>(m_data.data(), top_bit);
+        return;
+      }
+    }
     for (std::size_t i = 0; i < m_data.size(); ++i) {
       m_data[i] >>= 1;
       if (i + 1 < m_data.size()) {
@@ -153,6 +294,120 @@ struct BigNum
     }
   }
 
+  // right shift k bits, filling with zeros at the top
+  constexpr void shr(std::size_t k)
+  {
+    const std::size_t limbs = k / BitsPerLimb;
+    const unsigned bits = k % BitsPerLimb;
+    for (std::size_t i = 0; i < m_data.size(); ++i) {
+      // the source limbs are above i, so they have not been written yet
+      const std::size_t src = i + limbs;
+      const Limb lo = src < m_data.size() ? m_data[src] : Limb{};
+      const Limb hi = src + 1 < m_data.size() ? m_data[src + 1] : Limb{};
+      m_data[i] = bits == 0
+                    ? lo
+                    : static_cast<Limb>((lo >> bits) |
+                                        (hi << (BitsPerLimb - bits)));
+    }
+  }
+
+  // left shift k bits, the bits shifted above the top are lost
+  constexpr void shl(std::size_t k)
+  {
+    const std::size_t limbs = k / BitsPerLimb;
+    const unsigned bits = k % BitsPerLimb;
+    for (std::size_t i = m_data.size(); i-- > 0;) {
+      // the source limbs are below i, so they have not been written yet
+      const Limb hi = i >= limbs ? m_data[i - limbs] : Limb{};
+      const Limb lo = i >= limbs + 1 ? m_data[i - limbs - 1] : Limb{};
+      m_data[i] = bits == 0
+                    ? hi
+                    : static_cast<Limb>((hi << bits) |
+                                        (lo >> (BitsPerLimb - bits)));
+    }
+    clear_excess_bits();
+  }
+
+  /// bits pos, pos+1, ... pos+bits-1, in the low bits of the result
+  template<std::size_t bits>
+  constexpr std::uint64_t extract(std::size_t pos) const
+  {
+    static_assert(bits >= 1 && bits <= 64);
+    assert(pos + bits <= Nbits);
+    std::size_t limb = pos / BitsPerLimb;
+    const unsigned offset = pos % BitsPerLimb;
+    std::uint64_t ret = std::uint64_t{ m_data[limb] } >> offset;
+    // one more limb for 64 bit limbs, up to 8 for 8 bit ones
+    for (unsigned got = BitsPerLimb - offset; got < bits; got += BitsPerLimb) {
+      ret |= std::uint64_t{ m_data[++limb] } << got;
+    }
+    if constexpr (bits < 64) {
+      ret &= (std::uint64_t{ 1 } << bits) - 1;
+    }
+    return ret;
+  }
+
+  /// sets bits pos, pos+1, ... pos+bits-1 to the low bits of value
+  template<std::size_t bits>
+  constexpr void insert(std::size_t pos, std::uint64_t value)
+  {
+    static_assert(bits >= 1 && bits <= 64);
+    assert(pos + bits <= Nbits);
+    for (std::size_t done = 0; done < bits;) {
+      const std::size_t limb = (pos + done) / BitsPerLimb;
+      const unsigned offset = (pos + done) % BitsPerLimb;
+      const std::size_t n =
+        std::min<std::size_t>(BitsPerLimb - offset, bits - done);
+      const Limb ones = n == BitsPerLimb
+                          ? static_cast<Limb>(~Limb{})
+                          : static_cast<Limb>((Limb{ 1 } << n) - 1);
+      const Limb mask = static_cast<Limb>(ones << offset);
+      const Limb part =
+        static_cast<Limb>(static_cast<Limb>(value >> done) << offset);
+      m_data[limb] = static_cast<Limb>((m_data[limb] & ~mask) | (part & mask));
+      done += n;
+    }
+  }
+
+  constexpr BigNum& operator^=(const BigNum& other)
+  {
+    for (std::size_t i = 0; i < m_data.size(); ++i) {
+      m_data[i] ^= other.m_data[i];
+    }
+    return *this;
+  }
+
+  constexpr BigNum& operator&=(const BigNum& other)
+  {
+    for (std::size_t i = 0; i < m_data.size(); ++i) {
+      m_data[i] &= other.m_data[i];
+    }
+    return *this;
+  }
+
+  constexpr BigNum& operator|=(const BigNum& other)
+  {
+    for (std::size_t i = 0; i < m_data.size(); ++i) {
+      m_data[i] |= other.m_data[i];
+    }
+    return *this;
+  }
+
+  friend constexpr BigNum operator^(BigNum a, const BigNum& b)
+  {
+    return a ^= b;
+  }
+
+  friend constexpr BigNum operator&(BigNum a, const BigNum& b)
+  {
+    return a &= b;
+  }
+
+  friend constexpr BigNum operator|(BigNum a, const BigNum& b)
+  {
+    return a |= b;
+  }
+
   constexpr bool operator==(const BigNum& other) const
   {
     return m_data == other.m_data;
@@ -164,10 +419,29 @@ struct BigNum
   }
 
   /// lsb is in the beginning. the topmost excess bits at m_data.back() are kept
-  /// zero.
-  std::array<Limb, LimbCount> m_data{};
+  /// zero. large states are aligned for the simd shift.
+  alignas(detail::bignum_alignment<sizeof(Limb) * LimbCount, alignof(Limb)>)
+    std::array<Limb, LimbCount> m_data{};
 };
 
+/// the parity of the bits of x which are set in mask, as the popcount of the
+/// and of each limb. the limbs where mask is zero are skipped. with many taps
+/// this is cheaper than shifting each tap into place like parity_into_topbit.
+template<auto mask, int Nbits, typename Limb>
+constexpr bool
+masked_parity(const BigNum<Nbits, Limb>& x)
+{
+  static_assert(
+    std::is_same_v<std::remove_cvref_t<decltype(mask)>, BigNum<Nbits, Limb>>);
+  return [&]<std::size_t... i>(std::index_sequence<i...>) {
+    Limb sum{};
+    ((mask.m_data[i] != 0 ? void(sum ^= x.m_data[i] & mask.m_data[i])
+                          : void()),
+     ...);
+    return (std::popcount(sum) & 0x1) != 0;
+  }(std::make_index_sequence<BigNum<Nbits, Limb>::LimbCount>{});
+}
+
 template<int Nbits, typename Limb>
 requires requires
 {
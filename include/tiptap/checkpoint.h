@@ -0,0 +1,637 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define TIPTAP_HAS_MMAP 1
+#endif
+
+#include "lfsr_big.h"
+#include "lfsr_small.h"
+
+/**
+ * checkpointing of LFSR states, one or a whole bank of them, to a binary file.
+ *
+ * the file is a header followed by the taps and the states. the header is
+ * written in the byte order of the machine, with a marker telling which one
+ * it is, so the check and any swapping is done once per file. the states are
+ * the raw limbs, one record per state, where a record is the in memory size
+ * of the generator (the limbs followed by zeroed padding). the states start
+ * at a multiple of 64 bytes, so a file in native byte order can be mapped
+ * and used in place, see MappedBank.
+ *
+ *   offset  size  field
+ *        0     8  magic, "tiptapck"
+ *        8     4  byte order marker, 0x01020304
+ *       12     4  format version, 1
+ *       16     4  generator type, see CheckpointType
+ *       20     4  N, the size of the register
+ *       24     4  bytes per limb
+ *       28     4  bytes per record
+ *       32     4  number of taps
+ *       36     4  reserved, zero
+ *       40     8  number of states
+ *       48     8  offset of the first state
+ *       56  4*taps  the taps, in falling order
+ *
+ * the generators are BigLFSR and SmallLFSR. use_direct_top_bit does not
+ * affect the state and is not recorded.
+ */
+
+/// the kind of generator in a checkpoint
+enum class CheckpointType : std::uint32_t
+{
+  small_lfsr = 1,
+  big_lfsr = 2
+};
+
+/// the outcome of saving or loading a checkpoint
+enum class CheckpointStatus
+{
+  ok,
+  /// opening, reading or writing the file failed, see errno
+  io_error,
+  /// the magic is wrong
+  not_a_checkpoint,
+  unsupported_version,
+  /// the type, N, limb size or taps differ from the generator loaded into
+  wrong_generator,
+  /// the file is shorter than the header says
+  truncated,
+  /// the file has the other byte order, which can be loaded but not mapped
+  foreign_byte_order,
+  /// the record size or alignment differ from the generator, so the file
+  /// can be loaded but not mapped. also for a record size no generator of
+  /// the type can have, which can not be loaded either.
+  wrong_layout
+};
+
+constexpr const char*
+to_string(CheckpointStatus status)
+{
+  switch (status) {
+    case CheckpointStatus::ok:
+      return "ok";
+    case CheckpointStatus::io_error:
+      return "io error";
+    case CheckpointStatus::not_a_checkpoint:
+      return "not a checkpoint";
+    case CheckpointStatus::unsupported_version:
+      return "unsupported version";
+    case CheckpointStatus::wrong_generator:
+      return "wrong generator";
+    case CheckpointStatus::truncated:
+      return "truncated";
+    case CheckpointStatus::foreign_byte_order:
+      return "foreign byte order";
+    case CheckpointStatus::wrong_layout:
+      return "wrong layout";
+  }
+  return "unknown";
+}
+
+/**
+ * describes how a generator is stored. specialized for BigLFSR and
+ * SmallLFSR, other generators can be checkpointed by specializing it.
+ *
+ * Limb is the unit the byte order applies to, limb_count the number of limbs
+ * of the state and Taps an std::index_sequence. to_limbs and from_limbs
+ * convert between a generator and its limbs.
+ */
+template<typename Generator>
+struct CheckpointTraits;
+
+template<std::size_t N, typename Limb_, bool use_direct_top_bit, typename Taps_>
+struct CheckpointTraits<BigLFSR<N, Limb_, use_direct_top_bit, Taps_>>
+{
+  using Generator = BigLFSR<N, Limb_, use_direct_top_bit, Taps_>;
+  using Limb = Limb_;
+  using Taps = Taps_;
+  using State = BigNum<N, Limb>;
+  static constexpr CheckpointType type = CheckpointType::big_lfsr;
+  static constexpr std::size_t limb_count = State::LimbCount;
+
+  static void to_limbs(const Generator& g, Limb* out)
+  {
+    const State state = g.state();
+    std::copy(state.m_data.begin(), state.m_data.end(), out);
+  }
+  static Generator from_limbs(const Limb* in)
+  {
+    State state;
+    std::copy(in, in + limb_count, state.m_data.begin());
+    return Generator(state);
+  }
+};
+
+template<std::size_t N, bool use_direct_top_bit, typename State>
+struct CheckpointTraits<SmallLFSR<N, use_direct_top_bit, State>>
+{
+  using Generator = SmallLFSR<N, use_direct_top_bit, State>;
+  using Limb = State;
+  using Taps = decltype(getTaps<N>());
+  static constexpr CheckpointType type = CheckpointType::small_lfsr;
+  static constexpr std::size_t limb_count = 1;
+
+  static void to_limbs(const Generator& g, Limb* out) { *out = g.state(); }
+  static Generator from_limbs(const Limb* in) { return Generator(*in); }
+};
+
+namespace detail {
+inline constexpr std::array<char, 8> checkpoint_magic{ 't', 'i', 'p', 't',
+                                                       'a', 'p', 'c', 'k' };
+inline constexpr std::uint32_t checkpoint_byte_order = 0x01020304;
+inline constexpr std::uint32_t checkpoint_version = 1;
+/// the states start at a multiple of this, enough for the alignment of any
+/// BigNum
+inline constexpr std::uint64_t checkpoint_alignment = 64;
+/// states are read and written this many bytes at a time when they can not
+/// be copied as they are
+inline constexpr std::size_t checkpoint_chunk = std::size_t{ 1 } << 20;
+
+struct CheckpointHeader
+{
+  std::array<char, 8> magic;
+  std::uint32_t byte_order;
+  std::uint32_t version;
+  std::uint32_t type;
+  std::uint32_t nbits;
+  std::uint32_t limb_bytes;
+  std::uint32_t record_bytes;
+  std::uint32_t tap_count;
+  std::uint32_t reserved;
+  std::uint64_t count;
+  std::uint64_t payload_offset;
+};
+static_assert(sizeof(CheckpointHeader) == 56);
+static_assert(std::is_trivially_copyable_v<CheckpointHeader>);
+
+template<typename T>
+constexpr T
+byteswap(T x)
+{
+  static_assert(std::is_unsigned_v<T>);
+  if constexpr (sizeof(T) == 1) {
+    return x;
+  } else {
+    T ret{};
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+      ret = static_cast<T>((ret << 8) | (x & 0xFF));
+      x = static_cast<T>(x >> 8);
+    }
+    return ret;
+  }
+}
+
+inline void
+byteswap(CheckpointHeader& h)
+{
+  for (auto* field : { &h.byte_order,
+                       &h.version,
+                       &h.type,
+                       &h.nbits,
+                       &h.limb_bytes,
+                       &h.record_bytes,
+                       &h.tap_count,
+                       &h.reserved }) {
+    *field = byteswap(*field);
+  }
+  h.count = byteswap(h.count);
+  h.payload_offset = byteswap(h.payload_offset);
+}
+
+template<std::size_t... taps>
+constexpr std::array<std::uint32_t, sizeof...(taps)>
+taps_array(std::index_sequence<taps...>)
+{
+  return { static_cast<std::uint32_t>(taps)... };
+}
+
+template<typename Generator>
+struct CheckpointLayout
+{
+  using Traits = CheckpointTraits<Generator>;
+  using Limb = typename Traits::Limb;
+  static_assert(std::is_unsigned_v<Limb>);
+  static_assert(std::is_trivially_copyable_v<Generator>);
+
+  static constexpr auto taps = taps_array(typename Traits::Taps{});
+  static constexpr std::size_t state_bytes = Traits::limb_count * sizeof(Limb);
+  /// the in memory size, so a mapped file can be used as an array
+  static constexpr std::size_t record_bytes = sizeof(Generator);
+  static_assert(record_bytes >= state_bytes);
+  /// the largest record a file may have, the state padded for the largest
+  /// alignment a generator can have on any machine
+  static constexpr std::size_t max_record_bytes =
+    (state_bytes + checkpoint_alignment - 1) / checkpoint_alignment *
+    checkpoint_alignment;
+  static_assert(record_bytes <= max_record_bytes);
+  static constexpr std::uint64_t payload_offset =
+    (sizeof(CheckpointHeader) + sizeof(taps) + checkpoint_alignment - 1) /
+    checkpoint_alignment * checkpoint_alignment;
+  static_assert(checkpoint_alignment % alignof(Generator) == 0);
+
+  static CheckpointHeader header(std::uint64_t count)
+  {
+    return { checkpoint_magic,
+             checkpoint_byte_order,
+             checkpoint_version,
+             static_cast<std::uint32_t>(Traits::type),
+             static_cast<std::uint32_t>(Generator::bitcount()),
+             sizeof(Limb),
+             record_bytes,
+             static_cast<std::uint32_t>(taps.size()),
+             0,
+             count,
+             payload_offset };
+  }
+};
+
+/// reads and checks the header and taps, which are swapped to native byte
+/// order. swapped tells if the file has the other byte order.
+template<typename Generator>
+CheckpointStatus
+read_header(std::FILE* file, CheckpointHeader& header, bool& swapped)
+{
+  using Layout = CheckpointLayout<Generator>;
+  if (std::fread(&header, sizeof(header), 1, file) != 1) {
+    return std::ferror(file) ? CheckpointStatus::io_error
+                             : CheckpointStatus::not_a_checkpoint;
+  }
+  if (header.magic != checkpoint_magic) {
+    return CheckpointStatus::not_a_checkpoint;
+  }
+  swapped = header.byte_order != checkpoint_byte_order;
+  if (swapped) {
+    byteswap(header);
+    if (header.byte_order != checkpoint_byte_order) {
+      return CheckpointStatus::not_a_checkpoint;
+    }
+  }
+  if (header.version != checkpoint_version) {
+    return CheckpointStatus::unsupported_version;
+  }
+  const auto expected = Layout::header(header.count);
+  if (header.type != expected.type || header.nbits != expected.nbits ||
+      header.limb_bytes != expected.limb_bytes ||
+      header.tap_count != expected.tap_count) {
+    return CheckpointStatus::wrong_generator;
+  }
+  std::array<std::uint32_t, Layout::taps.size()> taps;
+  if (std::fread(taps.data(), sizeof(taps), 1, file) != 1) {
+    return CheckpointStatus::truncated;
+  }
+  if (swapped) {
+    for (auto& tap : taps) {
+      tap = byteswap(tap);
+    }
+  }
+  if (taps != Layout::taps) {
+    return CheckpointStatus::wrong_generator;
+  }
+  if (header.payload_offset < sizeof(header) + sizeof(taps)) {
+    return CheckpointStatus::not_a_checkpoint;
+  }
+  // the buffer for reading is sized from this, so it must not be arbitrary
+  if (header.record_bytes < Layout::state_bytes ||
+      header.record_bytes > Layout::max_record_bytes) {
+    return CheckpointStatus::wrong_layout;
+  }
+  return CheckpointStatus::ok;
+}
+
+struct FileClose
+{
+  void operator()(std::FILE* f) const { std::fclose(f); }
+};
+using File = std::unique_ptr<std::FILE, FileClose>;
+}
+
+/**
+ * writes the states of bank to path, replacing the file. bank can be a
+ * single generator with std::span(&lfsr, 1).
+ */
+template<typename Generator>
+CheckpointStatus
+save_bank(const std::filesystem::path& path,
+          std::span<const Generator> bank)
+{
+  using Layout = detail::CheckpointLayout<Generator>;
+  using Traits = CheckpointTraits<Generator>;
+  using Limb = typename Traits::Limb;
+
+  detail::File file(std::fopen(path.string().c_str(), "wb"));
+  if (!file) {
+    return CheckpointStatus::io_error;
+  }
+  const auto header = Layout::header(bank.size());
+  std::array<std::byte, Layout::payload_offset> prefix{};
+  std::memcpy(prefix.data(), &header, sizeof(header));
+  std::memcpy(
+    prefix.data() + sizeof(header), Layout::taps.data(), sizeof(Layout::taps));
+  bool ok = std::fwrite(prefix.data(), prefix.size(), 1, file.get()) == 1;
+
+  if (Layout::record_bytes == Layout::state_bytes) {
+    // no padding, the bank is already in the format of the file
+    ok = ok && std::fwrite(bank.data(), Layout::record_bytes, bank.size(),
+                           file.get()) == bank.size();
+  } else {
+    // copy the limbs, leaving the padding zero
+    constexpr std::size_t per_chunk =
+      std::max<std::size_t>(detail::checkpoint_chunk / Layout::record_bytes, 1);
+    std::vector<std::byte> buffer(per_chunk * Layout::record_bytes);
+    for (std::size_t begin = 0; ok && begin < bank.size();
+         begin += per_chunk) {
+      const std::size_t n = std::min(per_chunk, bank.size() - begin);
+      for (std::size_t i = 0; i < n; ++i) {
+        std::array<Limb, Traits::limb_count> limbs;
+        Traits::to_limbs(bank[begin + i], limbs.data());
+        std::memcpy(buffer.data() + i * Layout::record_bytes,
+                    limbs.data(),
+                    Layout::state_bytes);
+      }
+      ok = std::fwrite(buffer.data(), Layout::record_bytes, n, file.get()) == n;
+    }
+  }
+  ok = std::fclose(file.release()) == 0 && ok;
+  return ok ? CheckpointStatus::ok : CheckpointStatus::io_error;
+}
+
+/**
+ * reads the states saved by save_bank into bank, replacing its contents. the
+ * file may have been written on a machine with the other byte order. on
+ * failure bank is left empty.
+ */
+template<typename Generator>
+CheckpointStatus
+load_bank(const std::filesystem::path& path, std::vector<Generator>& bank)
+{
+  using Layout = detail::CheckpointLayout<Generator>;
+  using Traits = CheckpointTraits<Generator>;
+  using Limb = typename Traits::Limb;
+
+  bank.clear();
+  detail::File file(std::fopen(path.string().c_str(), "rb"));
+  if (!file) {
+    return CheckpointStatus::io_error;
+  }
+  detail::CheckpointHeader header;
+  bool swapped = false;
+  if (const auto status =
+        detail::read_header<Generator>(file.get(), header, swapped);
+      status != CheckpointStatus::ok) {
+    return status;
+  }
+  // check the size before allocating, the count may be garbage
+  std::error_code ec;
+  const auto filesize = std::filesystem::file_size(path, ec);
+  if (ec) {
+    return CheckpointStatus::io_error;
+  }
+  if (filesize < header.payload_offset ||
+      (filesize - header.payload_offset) / header.record_bytes <
+        header.count) {
+    return CheckpointStatus::truncated;
+  }
+  if (std::fseek(file.get(), static_cast<long>(header.payload_offset),
+                 SEEK_SET) != 0) {
+    return CheckpointStatus::io_error;
+  }
+  if (header.count == 0) {
+    return CheckpointStatus::ok;
+  }
+
+  if (!swapped && header.record_bytes == Layout::record_bytes) {
+    // the file has the in memory layout, read straight into the bank
+    bank.resize(header.count);
+    if (std::fread(bank.data(), Layout::record_bytes, bank.size(),
+                   file.get()) != bank.size()) {
+      bank.clear();
+      return CheckpointStatus::io_error;
+    }
+    return CheckpointStatus::ok;
+  }
+
+  bank.reserve(header.count);
+  const std::size_t per_chunk =
+    std::max<std::size_t>(detail::checkpoint_chunk / header.record_bytes, 1);
+  std::vector<std::byte> buffer(per_chunk * header.record_bytes);
+  for (std::uint64_t begin = 0; begin < header.count; begin += per_chunk) {
+    const std::size_t n =
+      static_cast<std::size_t>(std::min<std::uint64_t>(per_chunk,
+                                                       header.count - begin));
+    if (std::fread(buffer.data(), header.record_bytes, n, file.get()) != n) {
+      bank.clear();
+      return CheckpointStatus::io_error;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      std::array<Limb, Traits::limb_count> limbs;
+      std::memcpy(limbs.data(),
+                  buffer.data() + i * header.record_bytes,
+                  Layout::state_bytes);
+      if (swapped) {
+        for (auto& limb : limbs) {
+          limb = detail::byteswap(limb);
+        }
+      }
+      bank.push_back(Traits::from_limbs(limbs.data()));
+    }
+  }
+  return CheckpointStatus::ok;
+}
+
+/// saves a single generator
+template<typename Generator>
+CheckpointStatus
+save_checkpoint(const std::filesystem::path& path, const Generator& generator)
+{
+  return save_bank(path, std::span<const Generator>(&generator, 1));
+}
+
+/// loads a single generator, saved with save_checkpoint. on failure generator
+/// is not changed.
+template<typename Generator>
+CheckpointStatus
+load_checkpoint(const std::filesystem::path& path, Generator& generator)
+{
+  std::vector<Generator> bank;
+  auto status = load_bank(path, bank);
+  if (status == CheckpointStatus::ok) {
+    if (bank.size() != 1) {
+      return CheckpointStatus::wrong_generator;
+    }
+    generator = bank.front();
+  }
+  return status;
+}
+
+#ifdef TIPTAP_HAS_MMAP
+/// how MappedBank maps the file
+enum class MapMode
+{
+  /// changes to the states are private to the process, the file is not
+  /// modified. pages are copied when first written to.
+  private_copy,
+  /// changes to the states are written back to the file, which then is a
+  /// checkpoint of the current states, once flush() has been called
+  write_through
+};
+
+/**
+ * a bank file mapped into memory, with the states used in place without
+ * copying. only pages which are touched are read from the file, so opening
+ * is cheap for any size.
+ *
+ * the file must be in native byte order and have the in memory layout of
+ * Generator, which is the case for files saved by save_bank on the same
+ * kind of machine. otherwise status() tells why, and load_bank can still
+ * read it.
+ */
+template<typename Generator>
+class MappedBank
+{
+  using Layout = detail::CheckpointLayout<Generator>;
+
+public:
+  MappedBank() = default;
+
+  explicit MappedBank(const std::filesystem::path& path,
+                      MapMode mode = MapMode::private_copy)
+  {
+    m_status = map(path, mode);
+    if (m_status != CheckpointStatus::ok) {
+      unmap();
+    }
+  }
+
+  MappedBank(MappedBank&& other) noexcept { swap(other); }
+
+  MappedBank& operator=(MappedBank&& other) noexcept
+  {
+    MappedBank tmp(std::move(other));
+    swap(tmp);
+    return *this;
+  }
+
+  ~MappedBank() { unmap(); }
+
+  CheckpointStatus status() const { return m_status; }
+
+  /// the states, empty unless status() is ok
+  std::span<Generator> states() const { return m_states; }
+
+  /// writes changed states back to the file, for MapMode::write_through.
+  /// returns false on failure.
+  bool flush() const
+  {
+    return m_mapping == nullptr || ::msync(m_mapping, m_length, MS_SYNC) == 0;
+  }
+
+private:
+  CheckpointStatus map(const std::filesystem::path& path, MapMode mode)
+  {
+    const bool write = mode == MapMode::write_through;
+    const int fd = ::open(path.c_str(), write ? O_RDWR : O_RDONLY);
+    if (fd < 0) {
+      return CheckpointStatus::io_error;
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+      ::close(fd);
+      return CheckpointStatus::io_error;
+    }
+    m_length = static_cast<std::size_t>(st.st_size);
+    if (m_length < Layout::payload_offset) {
+      ::close(fd);
+      return CheckpointStatus::not_a_checkpoint;
+    }
+    void* p = ::mmap(nullptr,
+                     m_length,
+                     PROT_READ | PROT_WRITE,
+                     write ? MAP_SHARED : MAP_PRIVATE,
+                     fd,
+                     0);
+    // the mapping keeps the file alive
+    ::close(fd);
+    if (p == MAP_FAILED) {
+      m_length = 0;
+      return CheckpointStatus::io_error;
+    }
+    m_mapping = p;
+
+    detail::CheckpointHeader header;
+    std::memcpy(&header, m_mapping, sizeof(header));
+    if (header.magic != detail::checkpoint_magic) {
+      return CheckpointStatus::not_a_checkpoint;
+    }
+    if (header.byte_order != detail::checkpoint_byte_order) {
+      return CheckpointStatus::foreign_byte_order;
+    }
+    if (header.version != detail::checkpoint_version) {
+      return CheckpointStatus::unsupported_version;
+    }
+    const auto expected = Layout::header(header.count);
+    if (header.type != expected.type || header.nbits != expected.nbits ||
+        header.limb_bytes != expected.limb_bytes ||
+        header.tap_count != expected.tap_count ||
+        std::memcmp(static_cast<const std::byte*>(m_mapping) + sizeof(header),
+                    Layout::taps.data(),
+                    sizeof(Layout::taps)) != 0) {
+      return CheckpointStatus::wrong_generator;
+    }
+    if (header.record_bytes != Layout::record_bytes ||
+        header.payload_offset % alignof(Generator) != 0 ||
+        header.payload_offset < sizeof(header) + sizeof(Layout::taps)) {
+      return CheckpointStatus::wrong_layout;
+    }
+    if (m_length < header.payload_offset ||
+        (m_length - header.payload_offset) / Layout::record_bytes <
+          header.count) {
+      return CheckpointStatus::truncated;
+    }
+    m_states = std::span<Generator>(
+      reinterpret_cast<Generator*>(static_cast<std::byte*>(m_mapping) +
+                                   header.payload_offset),
+      static_cast<std::size_t>(header.count));
+    return CheckpointStatus::ok;
+  }
+
+  void unmap()
+  {
+    if (m_mapping != nullptr) {
+      ::munmap(m_mapping, m_length);
+    }
+    m_mapping = nullptr;
+    m_length = 0;
+    m_states = {};
+  }
+
+  void swap(MappedBank& other) noexcept
+  {
+    std::swap(m_status, other.m_status);
+    std::swap(m_mapping, other.m_mapping);
+    std::swap(m_length, other.m_length);
+    std::swap(m_states, other.m_states);
+  }
+
+  CheckpointStatus m_status = CheckpointStatus::io_error;
+  void* m_mapping = nullptr;
+  std::size_t m_length = 0;
+  std::span<Generator> m_states;
+};
+#endif
@@ -0,0 +1,376 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "lfsr_big.h"
+#include "lfsr_small.h"
+
+/**
+ * clock controlled generators, where several LFSRs are stepped or not
+ * depending on bits of their states, and the output is the xor of their
+ * output bits. A5/1 is the best known example, with three registers clocked
+ * by majority vote.
+ *
+ * a clocking rule gives the state bit each register contributes, and which
+ * registers to step given those bits. the rules are written with bitwise
+ * operations only, so the same rule serves the scalar generator (one bit per
+ * register) and the bitsliced one, which runs one instance per bit of a
+ * machine word and steps the registers with masked conditional shifts.
+ */
+
+/**
+ * A5/1 style majority clocking of three registers. ClockBits are the state
+ * bits compared, zero indexed with bit 0 being the output bit. a register is
+ * stepped if its clock bit agrees with the majority, so two or three of the
+ * registers step each time.
+ */
+template<std::size_t... ClockBits>
+struct MajorityClocking
+{
+  static_assert(sizeof...(ClockBits) == 3);
+
+  static constexpr std::size_t clock_bit(std::size_t reg)
+  {
+    constexpr std::array<std::size_t, 3> bits{ ClockBits... };
+    return bits[reg];
+  }
+
+  template<typename Word, std::size_t R>
+  static constexpr std::array<Word, R> enables(const std::array<Word, R>& bits)
+  {
+    static_assert(R == 3);
+    const Word majority =
+      (bits[0] & bits[1]) | (bits[0] & bits[2]) | (bits[1] & bits[2]);
+    return { ~(bits[0] ^ majority),
+             ~(bits[1] ^ majority),
+             ~(bits[2] ^ majority) };
+  }
+};
+
+/**
+ * stop and go clocking: the first register is always stepped, and the others
+ * are stepped when ControlBit of the first register is one.
+ */
+template<std::size_t ControlBit = 0>
+struct StopAndGoClocking
+{
+  static constexpr std::size_t clock_bit(std::size_t) { return ControlBit; }
+
+  template<typename Word, std::size_t R>
+  static constexpr std::array<Word, R> enables(const std::array<Word, R>& bits)
+  {
+    std::array<Word, R> ret;
+    ret.fill(bits[0]);
+    ret[0] = ~Word{};
+    return ret;
+  }
+};
+
+namespace detail {
+template<typename LFSR>
+constexpr bool
+state_bit(const LFSR& lfsr, std::size_t i)
+{
+  const auto state = lfsr.state();
+  if constexpr (std::is_integral_v<decltype(state)>) {
+    return (state >> i) & 0x1;
+  } else {
+    return state.ith_bit(i);
+  }
+}
+
+/// makes an LFSR with state bit i given by bit(i)
+template<typename LFSR, typename F>
+constexpr LFSR
+lfsr_from_bits(F&& bit)
+{
+  auto state = LFSR{}.state();
+  if constexpr (std::is_integral_v<decltype(state)>) {
+    state = 0;
+    for (std::size_t i = 0; i < LFSR::bitcount(); ++i) {
+      state |= static_cast<decltype(state)>(decltype(state){ bit(i) } << i);
+    }
+  } else {
+    for (std::size_t i = 0; i < LFSR::bitcount(); ++i) {
+      state.set_bit_to(i, bit(i));
+    }
+  }
+  return LFSR(state);
+}
+} // namespace detail
+
+/**
+ * the scalar generator. Registers are SmallLFSR or BigLFSR, the output bit is
+ * the xor of their output bits, and next() steps the registers the rule
+ * selects.
+ */
+template<typename Rule, typename... Registers>
+class ClockControlledGenerator
+{
+public:
+  static constexpr std::size_t RegisterCount = sizeof...(Registers);
+
+  constexpr ClockControlledGenerator() = default;
+
+  constexpr explicit ClockControlledGenerator(const Registers&... registers)
+    : m_registers(registers...)
+  {
+  }
+
+  constexpr void next() { next_impl(std::index_sequence_for<Registers...>{}); }
+
+  /// the output bit is the xor of the output bits of the registers
+  constexpr bool output() const
+  {
+    return std::apply([](const auto&... r) { return (r.output() ^ ...); },
+                      m_registers);
+  }
+
+  /// fills out with the output bits, least significant bit first
+  constexpr void generate(std::span<std::byte> out)
+  {
+    for (auto& byte : out) {
+      unsigned value = 0;
+      for (unsigned bit = 0; bit < 8; ++bit) {
+        value |= unsigned{ output() } << bit;
+        next();
+      }
+      byte = std::byte(value);
+    }
+  }
+
+  constexpr const std::tuple<Registers...>& registers() const
+  {
+    return m_registers;
+  }
+
+private:
+  template<std::size_t... I>
+  constexpr void next_impl(std::index_sequence<I...>)
+  {
+    const std::array<unsigned, RegisterCount> bits{ unsigned{
+      detail::state_bit(std::get<I>(m_registers), Rule::clock_bit(I)) }... };
+    const auto enable = Rule::enables(bits);
+    ((enable[I] & 0x1 ? std::get<I>(m_registers).next() : void()), ...);
+  }
+
+  std::tuple<Registers...> m_registers;
+};
+
+/**
+ * a word of 64*K lanes for the bitsliced generators. the operations are plain
+ * loops, which the compiler turns into simd instructions when the target has
+ * them, e.g. K=4 for avx2 and K=8 for avx-512.
+ */
+template<std::size_t K>
+struct LaneWord
+{
+  std::array<std::uint64_t, K> m_words{};
+
+  friend constexpr LaneWord operator&(const LaneWord& a, const LaneWord& b)
+  {
+    LaneWord ret;
+    for (std::size_t i = 0; i < K; ++i) {
+      ret.m_words[i] = a.m_words[i] & b.m_words[i];
+    }
+    return ret;
+  }
+  friend constexpr LaneWord operator|(const LaneWord& a, const LaneWord& b)
+  {
+    LaneWord ret;
+    for (std::size_t i = 0; i < K; ++i) {
+      ret.m_words[i] = a.m_words[i] | b.m_words[i];
+    }
+    return ret;
+  }
+  friend constexpr LaneWord operator^(const LaneWord& a, const LaneWord& b)
+  {
+    LaneWord ret;
+    for (std::size_t i = 0; i < K; ++i) {
+      ret.m_words[i] = a.m_words[i] ^ b.m_words[i];
+    }
+    return ret;
+  }
+  constexpr LaneWord operator~() const
+  {
+    LaneWord ret;
+    for (std::size_t i = 0; i < K; ++i) {
+      ret.m_words[i] = ~m_words[i];
+    }
+    return ret;
+  }
+  constexpr LaneWord& operator^=(const LaneWord& other)
+  {
+    return *this = *this ^ other;
+  }
+  constexpr bool operator==(const LaneWord&) const = default;
+};
+
+namespace detail {
+template<typename Word>
+inline constexpr std::size_t lane_count = 8 * sizeof(Word);
+
+template<typename Word>
+constexpr bool
+lane(const Word& word, std::size_t i)
+{
+  if constexpr (std::is_integral_v<Word>) {
+    return (word >> i) & 0x1;
+  } else {
+    return (word.m_words[i / 64] >> (i % 64)) & 0x1;
+  }
+}
+
+template<typename Word>
+constexpr void
+set_lane(Word& word, std::size_t i, bool value)
+{
+  if constexpr (std::is_integral_v<Word>) {
+    word |= Word{ value } << i;
+  } else {
+    word.m_words[i / 64] |= std::uint64_t{ value } << (i % 64);
+  }
+}
+} // namespace detail
+
+/**
+ * an LFSR of size N for each lane of Word, stored as N bit planes: plane i
+ * holds bit i of the state of every lane. stepping is the same shift and
+ * feedback as BigLFSR, done for all lanes at once. Taps is an
+ * std::index_sequence like the one of BigLFSR.
+ */
+template<std::size_t N,
+         typename Word,
+         typename Taps = decltype(getTaps<N>())>
+class BitslicedLFSR
+{
+public:
+  /// steps the lanes which are set in enable, the others keep their state
+  constexpr void next(const Word& enable)
+  {
+    const Word top = feedback(Taps{});
+    for (std::size_t i = 0; i + 1 < N; ++i) {
+      m_planes[i] ^= (m_planes[i] ^ m_planes[i + 1]) & enable;
+    }
+    m_planes[N - 1] ^= (m_planes[N - 1] ^ top) & enable;
+  }
+
+  constexpr const Word& output() const { return m_planes[0]; }
+
+  /// bit i of the state of every lane
+  constexpr const Word& bit(std::size_t i) const { return m_planes[i]; }
+
+  constexpr void set_bit(std::size_t i, std::size_t lane, bool value)
+  {
+    detail::set_lane(m_planes[i], lane, value);
+  }
+
+  static constexpr std::size_t bitcount() { return N; }
+
+private:
+  template<std::size_t... taps>
+  constexpr Word feedback(std::index_sequence<taps...>) const
+  {
+    // the same as the parity of the taps in BigLFSR and SmallLFSR
+    return (m_planes[N - taps] ^ ...);
+  }
+
+  std::array<Word, N> m_planes{};
+};
+
+/**
+ * runs up to 64*K (or the number of bits in Word) instances of
+ * ClockControlledGenerator<Rule, Registers...> in parallel. each instance
+ * clocks its registers independently, through the masks the rule computes
+ * from the bit planes.
+ */
+template<typename Word, typename Rule, typename... Registers>
+class BitslicedClockControlledGenerator
+{
+public:
+  using Scalar = ClockControlledGenerator<Rule, Registers...>;
+  static constexpr std::size_t Lanes = detail::lane_count<Word>;
+
+  /// lane i starts as instances[i]. unused lanes are all zero and stay so.
+  explicit BitslicedClockControlledGenerator(std::span<const Scalar> instances)
+    : m_used(instances.size())
+  {
+    assert(instances.size() <= Lanes);
+    for (std::size_t lane = 0; lane < instances.size(); ++lane) {
+      load(lane,
+           instances[lane].registers(),
+           std::index_sequence_for<Registers...>{});
+    }
+  }
+
+  constexpr void next() { next_impl(std::index_sequence_for<Registers...>{}); }
+
+  /// the output bit of every lane
+  constexpr Word output() const
+  {
+    return std::apply([](const auto&... r) { return (r.output() ^ ...); },
+                      m_registers);
+  }
+
+  /// out[t] is the output of every lane at step t
+  constexpr void generate(std::span<Word> out)
+  {
+    for (auto& word : out) {
+      word = output();
+      next();
+    }
+  }
+
+  /// the instance in a lane, as a scalar generator
+  Scalar lane(std::size_t i) const
+  {
+    assert(i < m_used);
+    return extract(i, std::index_sequence_for<Registers...>{});
+  }
+
+private:
+  template<std::size_t... I>
+  constexpr void next_impl(std::index_sequence<I...>)
+  {
+    const std::array<Word, sizeof...(Registers)> bits{
+      std::get<I>(m_registers).bit(Rule::clock_bit(I))...
+    };
+    const auto enable = Rule::enables(bits);
+    (std::get<I>(m_registers).next(enable[I]), ...);
+  }
+
+  template<std::size_t... I>
+  void load(std::size_t lane,
+            const std::tuple<Registers...>& registers,
+            std::index_sequence<I...>)
+  {
+    (
+      [&] {
+        auto& planes = std::get<I>(m_registers);
+        for (std::size_t b = 0; b < planes.bitcount(); ++b) {
+          planes.set_bit(b, lane, detail::state_bit(std::get<I>(registers), b));
+        }
+      }(),
+      ...);
+  }
+
+  template<std::size_t... I>
+  Scalar extract(std::size_t lane, std::index_sequence<I...>) const
+  {
+    return Scalar(detail::lfsr_from_bits<Registers>([&](std::size_t b) {
+      return detail::lane(std::get<I>(m_registers).bit(b), lane);
+    })...);
+  }
+
+  std::tuple<
+    BitslicedLFSR<Registers::bitcount(), Word, typename Registers::Taps>...>
+    m_registers;
+  std::size_t m_used;
+};
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "bignum.h"
+
+/**
+ * periodic correlation of bit sequences at every shift, for checking the
+ * correlation properties of m-sequences and spreading codes.
+ *
+ * the sequences are packed 64 bits per word with the first bit in the least
+ * significant bit, like the codes in spreading_codes.h. the correlation at a
+ * shift is the number of agreeing bits minus the number of differing ones,
+ * which is length - 2*popcount(a xor (b shifted)).
+ *
+ * computing all shifts is O(length^2) bit operations. the shifts are grouped
+ * by their offset within a word: for each of the 64 offsets, b is funnel
+ * shifted once, after which every shift with that offset is an aligned
+ * xor+popcount loop that the compiler can vectorize. 8 of those shifts are
+ * done per pass over the words, and the offsets are spread over threads.
+ *
+ * the speed depends on the popcount the compiler may use. all shifts of a
+ * period of 2^20 take about 1.5 s on one core with -march=native on a cpu with
+ * avx-512 vpopcntdq, 5 s with avx2 at -O3 and 10 s with only -mpopcnt. with
+ * the default x86-64 flags there is no popcount instruction and it takes
+ * about 45 s.
+ */
+
+namespace detail {
+
+/// b repeated, so that length bits can be read from any offset below length
+inline std::vector<std::uint64_t>
+repeat_bits(std::span<const std::uint64_t> b, std::uint64_t length)
+{
+  const std::uint64_t bits = 2 * length + 128;
+  std::vector<std::uint64_t> ret(bits / 64 + 1);
+  std::uint64_t source = 0;
+  for (std::uint64_t n = 0; n < bits; ++n) {
+    ret[n / 64] |= ((b[source / 64] >> (source % 64)) & 0x1) << (n % 64);
+    if (++source == length) {
+      source = 0;
+    }
+  }
+  return ret;
+}
+
+/// the number of differing bits between a and b+k for k below Shifts, where
+/// the last word is masked with tail. doing several shifts per pass reuses
+/// the loads, which matters once a and b no longer fit in L1.
+template<std::size_t Shifts>
+std::array<std::uint64_t, Shifts>
+differing_bits(const std::uint64_t* a,
+               const std::uint64_t* b,
+               std::size_t words,
+               std::uint64_t tail)
+{
+  std::array<std::uint64_t, Shifts> sums{};
+  for (std::size_t i = 0; i + 1 < words; ++i) {
+    for (std::size_t k = 0; k < Shifts; ++k) {
+      sums[k] += static_cast<std::uint64_t>(std::popcount(a[i] ^ b[i + k]));
+    }
+  }
+  for (std::size_t k = 0; k < Shifts; ++k) {
+    sums[k] += static_cast<std::uint64_t>(
+      std::popcount((a[words - 1] ^ b[words - 1 + k]) & tail));
+  }
+  return sums;
+}
+} // namespace detail
+
+/**
+ * the periodic cross correlation of a and b, both of period length. element k
+ * of the result is the correlation of a with b advanced k bits.
+ */
+inline std::vector<std::int64_t>
+periodic_correlation(std::span<const std::uint64_t> a,
+                     std::span<const std::uint64_t> b,
+                     std::uint64_t length,
+                     unsigned threads = std::thread::hardware_concurrency())
+{
+  std::vector<std::int64_t> ret(length);
+  if (length == 0) {
+    return ret;
+  }
+  const std::size_t words = (length + 63) / 64;
+  assert(a.size() >= words && b.size() >= words);
+  const std::uint64_t tail =
+    length % 64 == 0 ? ~std::uint64_t{}
+                     : (std::uint64_t{ 1 } << (length % 64)) - 1;
+  const auto repeated = detail::repeat_bits(b, length);
+  constexpr std::size_t Block = 8;
+
+  const auto offsets =
+    static_cast<unsigned>(std::min<std::uint64_t>(64, length));
+  std::atomic<unsigned> next_offset{ 0 };
+  auto worker = [&]() {
+    std::vector<std::uint64_t> shifted(repeated.size() - 1);
+    for (;;) {
+      const unsigned offset = next_offset.fetch_add(1);
+      if (offset >= offsets) {
+        return;
+      }
+      for (std::size_t i = 0; i < shifted.size(); ++i) {
+        shifted[i] =
+          detail::funnel_shift(repeated[i], repeated[i + 1], offset);
+      }
+      // the shifts with this offset are one word apart, Block at a time
+      std::uint64_t shift = offset;
+      for (; shift + 64 * (Block - 1) < length; shift += 64 * Block) {
+        const auto differing = detail::differing_bits<Block>(
+          a.data(), shifted.data() + shift / 64, words, tail);
+        for (std::size_t k = 0; k < Block; ++k) {
+          ret[shift + 64 * k] = static_cast<std::int64_t>(length) -
+                                2 * static_cast<std::int64_t>(differing[k]);
+        }
+      }
+      for (; shift < length; shift += 64) {
+        const auto differing = detail::differing_bits<1>(
+          a.data(), shifted.data() + shift / 64, words, tail);
+        ret[shift] = static_cast<std::int64_t>(length) -
+                     2 * static_cast<std::int64_t>(differing[0]);
+      }
+    }
+  };
+
+  threads = std::clamp(threads, 1U, offsets);
+  {
+    std::vector<std::jthread> pool;
+    for (unsigned i = 1; i < threads; ++i) {
+      pool.emplace_back(worker);
+    }
+    worker();
+  }
+  return ret;
+}
+
+/// the periodic autocorrelation of a, of period length
+inline std::vector<std::int64_t>
+periodic_autocorrelation(std::span<const std::uint64_t> a,
+                         std::uint64_t length,
+                         unsigned threads = std::thread::hardware_concurrency())
+{
+  return periodic_correlation(a, a, length, threads);
+}
+
+/// summary of a correlation spectrum
+struct CorrelationSummary
+{
+  /// the largest value, and the first shift where it occurs
+  std::int64_t max_value{};
+  std::uint64_t max_shift{};
+  /// the smallest value, and the first shift where it occurs
+  std::int64_t min_value{};
+  std::uint64_t min_shift{};
+  /// the largest absolute value away from shift zero, which for an
+  /// autocorrelation is the largest sidelobe
+  std::int64_t max_off_peak{};
+  /// how many shifts have each value
+  std::map<std::int64_t, std::uint64_t> values;
+};
+
+inline CorrelationSummary
+summarize(std::span<const std::int64_t> spectrum)
+{
+  CorrelationSummary ret;
+  if (spectrum.empty()) {
+    return ret;
+  }
+  ret.max_value = ret.min_value = spectrum[0];
+  for (std::uint64_t shift = 0; shift < spectrum.size(); ++shift) {
+    const auto value = spectrum[shift];
+    if (value > ret.max_value) {
+      ret.max_value = value;
+      ret.max_shift = shift;
+    }
+    if (value < ret.min_value) {
+      ret.min_value = value;
+      ret.min_shift = shift;
+    }
+    if (shift > 0) {
+      ret.max_off_peak =
+        std::max(ret.max_off_peak, value < 0 ? -value : value);
+    }
+    ++ret.values[value];
+  }
+  return ret;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+// an lfsr counter encrypted with aes. needs AES-NI, see aes.h.
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+#include "aes.h"
+#include "lfsr_big.h"
+
+/**
+ * generates pseudo random data by encrypting the successive states of a 128
+ * bit LFSR with aes, by default with the FIPS-197 example key and the
+ * standard number of rounds. block i of the output is the encryption of the
+ * counter state after i+1 steps.
+ *
+ * aesenc has a latency of several cycles but a throughput of one or two per
+ * cycle, so encrypting one block at a time leaves most of the capacity
+ * unused. generate() therefore steps the counter BlocksInFlight times,
+ * collecting the states, and encrypts that batch with the rounds interleaved.
+ */
+class EncryptedCounter
+{
+public:
+  using Counter = BigLFSR<128, std::uint64_t>;
+  static constexpr std::size_t BlockSize = 16;
+  static constexpr std::size_t BlocksInFlight = 8;
+
+  EncryptedCounter() = default;
+
+  explicit EncryptedCounter(const Aes& cipher,
+                            const Counter& counter = Counter{})
+    : m_aes(cipher)
+    , m_counter(counter)
+  {
+  }
+
+  /// steps the counter and returns the encrypted state
+  __m128i next_block()
+  {
+    m_counter.next();
+    return m_aes.encrypt(counter_block());
+  }
+
+  /// fills out with the same data as repeated calls to next_block() would
+  /// give. if out.size() is not a multiple of BlockSize, the rest of the last
+  /// block is discarded.
+  void generate(std::span<std::byte> out)
+  {
+    constexpr std::size_t batchsize = BlockSize * BlocksInFlight;
+    std::size_t pos = 0;
+    for (; pos + batchsize <= out.size(); pos += batchsize) {
+      M128Array<BlocksInFlight> blocks;
+      for (auto& block : blocks) {
+        m_counter.next();
+        block = counter_block();
+      }
+      m_aes.encrypt(blocks);
+      for (std::size_t i = 0; i < BlocksInFlight; ++i) {
+        _mm_storeu_si128(
+          reinterpret_cast<__m128i*>(out.data() + pos + i * BlockSize),
+          blocks[i]);
+      }
+    }
+    for (; pos < out.size(); pos += BlockSize) {
+      const auto block = next_block();
+      std::memcpy(
+        out.data() + pos, &block, std::min(BlockSize, out.size() - pos));
+    }
+  }
+
+  /// observe the counter
+  const Counter& counter() const { return m_counter; }
+
+  const Aes& cipher() const { return m_aes; }
+
+private:
+  /// the counter state as a block, least significant limb first
+  __m128i counter_block() const
+  {
+    const auto state = m_counter.state();
+    return _mm_set_epi64x(static_cast<long long>(state.m_data[1]),
+                          static_cast<long long>(state.m_data[0]));
+  }
+
+  Aes m_aes;
+  Counter m_counter;
+};
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace detail {
+// preferred pairs for Gold codes.
+//
+// if u is the m-sequence of the LFSR with the taps from lfsr_coefficients.h,
+// its decimation v[n] = u[q*n] with q = 2^k+1 is also an m-sequence, and u and
+// v are a preferred pair (their cross correlation takes only three values)
+// when gcd(N, k) = 1 for odd N, or gcd(N, k) = 2 for N = 2 mod 4. see
+// R. Gold, "Maximal recursive sequences with 3-valued recursive
+// cross-correlation functions", IEEE Trans. Inf. Theory 14, 1968.
+// there are no preferred pairs for N divisible by 4.
+//
+// the pair is stored as the decimation rather than as the taps of a second
+// LFSR, so both sequences come from the LFSR in the table and can be
+// positioned with its jump ahead.
+
+/// the decimation q giving the preferred partner of the size N m-sequence
+template<std::size_t N>
+constexpr std::uint64_t
+getGoldDecimation()
+{
+  static_assert(N % 4 != 0,
+                "there are no preferred pairs for N divisible by 4");
+  // k = 1 for odd N, k = 2 for N = 2 mod 4
+  return N % 2 == 1 ? 3 : 5;
+}
+
+/// the decimation for the small Kasami set, 2^(N/2)+1. the decimated
+/// sequence has period 2^(N/2)-1.
+template<std::size_t N>
+constexpr std::uint64_t
+getKasamiDecimation()
+{
+  static_assert(N % 2 == 0, "the small Kasami set needs an even N");
+  return (std::uint64_t{ 1 } << (N / 2)) + 1;
+}
+} // namespace detail
@@ -1,9 +1,38 @@
 #pragma once
 
 #include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
 
 #include "bignum.h"
 #include "lfsr_coefficients.h"
+#include "lfsr_jump.h"
+#include "output_ranges.h"
+
+namespace detail {
+/// with more taps than this, the feedback is computed as the parity of the
+/// state anded with a mask of the taps instead of one shift per tap. the
+/// numbers are the crossovers in the throughput benchmark. without a popcount
+/// instruction the parity takes several operations, and states shifted with
+/// simd live in vector registers, from which single limbs are slow to get.
+template<typename State>
+constexpr std::size_t
+dense_tap_threshold()
+{
+  if (State::UseSimdShift) {
+    return 24;
+  }
+#if defined(__POPCNT__)
+  return 4;
+#else
+  return 16;
+#endif
+}
+} // namespace detail
 
 // the size of the shift register
 /**
@@ -12,20 +41,51 @@
  * might want to benchmark how it affects the performance for you choice of N
  * with the particular system and compiler you have. use_direct_top_bit controls
  * how the implementation sets the top bit after shift, it affects performance
- * but not functionality.
+ * but not functionality. Taps is an std::index_sequence with the taps in
+ * falling order, by default the ones from lfsr_coefficients.h. any number of
+ * taps can be given, e.g. for a dense polynomial from a standard.
  */
 template<std::size_t N,
          typename Limb = unsigned int,
-         bool use_direct_top_bit = true>
+         bool use_direct_top_bit = true,
+         typename Taps_ = decltype(getTaps<N>())>
 class BigLFSR
 {
   using State = BigNum<N, Limb>;
 
 public:
+  /// the taps, as an std::index_sequence
+  using Taps = Taps_;
+
+private:
+
+  /// the state bits the taps read, bit N-tap for each tap
+  static constexpr State tap_mask()
+  {
+    State ret{};
+    [&]<std::size_t... taps>(std::index_sequence<taps...>) {
+      static_assert(((taps >= 1 && taps <= N) && ...));
+      (ret.set_bit_to(N - taps, true), ...);
+    }(Taps{});
+    return ret;
+  }
+
+public:
+  constexpr BigLFSR() = default;
+
+  /// starts from the given state, which must not be all zeros
+  constexpr explicit BigLFSR(const State& state)
+    : m_state(state)
+  {
+    assert(state != State{});
+  }
+
   constexpr void next()
   {
-    constexpr auto taps = getTaps<N>();
-    if constexpr (use_direct_top_bit) {
+    constexpr Taps taps{};
+    if constexpr (Taps::size() > detail::dense_tap_threshold<State>()) {
+      m_state.shr_one_bit(masked_parity<tap_mask()>(m_state));
+    } else if constexpr (use_direct_top_bit) {
       const auto topbit = m_state.parity_into_topbit(taps_to_bits(taps));
       // do the equivalent of  m_state = (m_state >> 1) | (bit << (N - 1));
       m_state.shr_one_bit(topbit);
@@ -36,6 +96,84 @@ public:
     }
   }
 
+  /// advances the state as if next() was called steps times. the cost is
+  /// about N calls to next(), independent of steps.
+  constexpr void jump(std::uint64_t steps)
+  {
+    if (steps <= N) {
+      for (std::uint64_t i = 0; i < steps; ++i) {
+        next();
+      }
+    } else {
+      apply(jump_polynomial(steps));
+    }
+  }
+
+  /// the polynomial which jump(steps) applies. when jumping the same distance
+  /// many times, compute it once and pass it to jump(poly).
+  static constexpr detail::Gf2Poly<N> jump_polynomial(std::uint64_t steps)
+  {
+    return detail::jump_polynomial<N>(steps, Taps{});
+  }
+
+  /// advances the state by the distance poly was made for, with
+  /// jump_polynomial(). the cost is about N calls to next().
+  constexpr void jump(const detail::Gf2Poly<N>& poly) { apply(poly); }
+
+  /// returns a copy advanced i*stride steps, i*stride must fit in 64 bits
+  constexpr BigLFSR substream(std::uint64_t i, std::uint64_t stride) const
+  {
+    assert(stride == 0 ||
+           i <= std::numeric_limits<std::uint64_t>::max() / stride);
+    BigLFSR ret = *this;
+    ret.jump(i * stride);
+    return ret;
+  }
+
+  /// returns k copies, where copy i is advanced i*stride steps. this is
+  /// typically used to let k threads work on consecutive parts of the output
+  /// which are stride steps long.
+  std::vector<BigLFSR> split(std::size_t k, std::uint64_t stride) const
+  {
+    std::vector<BigLFSR> ret;
+    ret.reserve(k);
+    if (k > 0) {
+      ret.push_back(*this);
+    }
+    const auto poly = jump_polynomial(stride);
+    while (ret.size() < k) {
+      ret.push_back(ret.back());
+      ret.back().jump(poly);
+    }
+    return ret;
+  }
+
+  /// the output bit is the bit shifted out at the bottom on the next step
+  constexpr bool output() const { return m_state.m_data[0] & 0x1; }
+
+  /// fills out with the output bits, least significant bit first. advances
+  /// the state 8*out.size() steps.
+  constexpr void generate(std::span<std::byte> out)
+  {
+    for (auto& byte : out) {
+      unsigned value = 0;
+      for (unsigned bit = 0; bit < 8; ++bit) {
+        value |= unsigned{ output() } << bit;
+        next();
+      }
+      byte = std::byte(value);
+    }
+  }
+
+  /// the output from the current state on, as ranges of bits, 64 bit words
+  /// or chunks of words, see output_ranges.h. this lfsr is not advanced.
+  auto bits() const { return OutputBitsView<BigLFSR>(*this); }
+  auto words() const { return OutputWordsView<BigLFSR>(*this); }
+  auto chunks() const { return OutputChunksView<BigLFSR>(*this); }
+
+  /// the size of the shift register
+  static constexpr std::size_t bitcount() { return N; }
+
   /// observe the state
   constexpr State state() const { return m_state; }
 
@@ -45,5 +183,20 @@ private:
   {
     return std::index_sequence<(N - ints)...>{};
   }
+
+  /// replaces the state with the sum of the states after i steps, for each i
+  /// where the polynomial has a nonzero coefficient
+  constexpr void apply(const detail::Gf2Poly<N>& poly)
+  {
+    State sum{};
+    for (std::size_t i = 0; i < N; ++i) {
+      if (poly.bit(i)) {
+        sum ^= m_state;
+      }
+      next();
+    }
+    m_state = sum;
+  }
+
   State m_state{ 1 };
 };
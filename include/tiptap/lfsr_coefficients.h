@@ -1,12 +1,56 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
+#include <utility>
 
 namespace detail {
+/// the most taps an entry in the table can have
+inline constexpr std::size_t max_taps = 32;
+
+/// the number of taps in a table entry, which ends at the first zero
+template<std::size_t Size>
+constexpr std::size_t
+tap_count(const std::array<int, Size>& rawtaps)
+{
+  std::size_t ret = 0;
+  while (ret < Size && rawtaps[ret] != 0) {
+    ++ret;
+  }
+  return ret;
+}
+
+/// at least two taps, in falling order, the first at most N and the entries
+/// after the last tap zero
+template<std::size_t Size>
+constexpr bool
+valid_taps(const std::array<int, Size>& rawtaps, int N)
+{
+  const std::size_t count = tap_count(rawtaps);
+  if (count < 2 || rawtaps[0] > N) {
+    return false;
+  }
+  for (std::size_t i = 1; i < Size; ++i) {
+    if (i < count ? rawtaps[i] >= rawtaps[i - 1] : rawtaps[i] != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template<auto rawtaps, std::size_t... i>
+constexpr auto
+taps_sequence(std::index_sequence<i...>)
+{
+  return std::index_sequence<static_cast<std::size_t>(rawtaps[i])...>{};
+}
+
 // the data N=3 to N=168 is from
 // http://scott.joviansynth.com/electronics/LFSRtaps.html
 // but some were edited (in particular the N=16 entry, to match the wikipedia
-// LFSR article)
+// LFSR article). the second tap for N=33, 49, 57 and 79 had lost its trailing
+// zero, which made the period shorter than maximal. see verify_period.h for
+// how to check the period.
 //
 // here is a very long list of taps by Roy Ward and Tim Molteno, from which the
 // entries above 168 were taken
@@ -24,7 +68,7 @@ getTapsImpl()
   {
     int bits;
   };
-  using RawTaps = std::array<int, 4>;
+  using RawTaps = std::array<int, max_taps>;
   struct Pair
   {
     Nbits nbits;
@@ -70,7 +114,7 @@ getTapsImpl()
     { Nbits{ 30 }, RawTaps{ 30, 6, 4, 1 } },
     { Nbits{ 31 }, RawTaps{ 31, 28 } },
     { Nbits{ 32 }, RawTaps{ 32, 22, 2, 1 } },
-    { Nbits{ 33 }, RawTaps{ 33, 2 } },
+    { Nbits{ 33 }, RawTaps{ 33, 20 } },
     { Nbits{ 34 }, RawTaps{ 34, 27, 2, 1 } },
     { Nbits{ 35 }, RawTaps{ 35, 33 } },
     { Nbits{ 36 }, RawTaps{ 36, 25 } },
@@ -86,7 +130,7 @@ getTapsImpl()
     { Nbits{ 46 }, RawTaps{ 46, 45, 26, 25 } },
     { Nbits{ 47 }, RawTaps{ 47, 42 } },
     { Nbits{ 48 }, RawTaps{ 48, 47, 21, 20 } },
-    { Nbits{ 49 }, RawTaps{ 49, 4 } },
+    { Nbits{ 49 }, RawTaps{ 49, 40 } },
     { Nbits{ 50 }, RawTaps{ 50, 49, 24, 23 } },
     { Nbits{ 51 }, RawTaps{ 51, 50, 36, 35 } },
     { Nbits{ 52 }, RawTaps{ 52, 49 } },
@@ -94,7 +138,7 @@ getTapsImpl()
     { Nbits{ 54 }, RawTaps{ 54, 53, 18, 17 } },
     { Nbits{ 55 }, RawTaps{ 55, 31 } },
     { Nbits{ 56 }, RawTaps{ 56, 55, 35, 34 } },
-    { Nbits{ 57 }, RawTaps{ 57, 5 } },
+    { Nbits{ 57 }, RawTaps{ 57, 50 } },
     { Nbits{ 58 }, RawTaps{ 58, 39 } },
     { Nbits{ 59 }, RawTaps{ 59, 58, 38, 37 } },
     { Nbits{ 60 }, RawTaps{ 60, 59 } },
@@ -116,7 +160,7 @@ getTapsImpl()
     { Nbits{ 76 }, RawTaps{ 76, 75, 41, 40 } },
     { Nbits{ 77 }, RawTaps{ 77, 76, 47, 46 } },
     { Nbits{ 78 }, RawTaps{ 78, 77, 59, 58 } },
-    { Nbits{ 79 }, RawTaps{ 79, 7 } },
+    { Nbits{ 79 }, RawTaps{ 79, 70 } },
     { Nbits{ 80 }, RawTaps{ 80, 79, 43, 42 } },
     { Nbits{ 81 }, RawTaps{ 81, 77 } },
     { Nbits{ 82 }, RawTaps{ 82, 79, 47, 44 } },
@@ -233,19 +277,7 @@ constexpr auto
 getTaps()
 {
   constexpr auto rawtaps = detail::getTapsImpl<N>();
-  static_assert(rawtaps[0] <= N);
-  static_assert(rawtaps[0] != 0);
-  static_assert(rawtaps[1] != 0);
-  static_assert(rawtaps[0] > rawtaps[1]);
-  if constexpr (rawtaps[2] == 0) {
-    static_assert(rawtaps[3] == 0);
-    return std::index_sequence<rawtaps[0], rawtaps[1]>{};
-  } else {
-    static_assert(rawtaps[2] != 0);
-    static_assert(rawtaps[1] > rawtaps[2]);
-    static_assert(rawtaps[3] != 0);
-    static_assert(rawtaps[2] > rawtaps[3]);
-    return std::
-      index_sequence<rawtaps[0], rawtaps[1], rawtaps[2], rawtaps[3]>{};
-  }
+  static_assert(detail::valid_taps(rawtaps, N));
+  return detail::taps_sequence<rawtaps>(
+    std::make_index_sequence<detail::tap_count(rawtaps)>{});
 }
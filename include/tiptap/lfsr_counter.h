@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "lfsr_small.h"
+
+/// the modulus of an LfsrCounter is given at runtime
+inline constexpr std::uint64_t dynamic_modulus = 0;
+
+namespace detail {
+/// the state an LFSR starting from the default state is in after steps steps
+template<std::size_t N>
+constexpr auto
+lfsr_state_after(std::uint64_t steps)
+{
+  SmallLFSR<N> lfsr;
+  lfsr.jump(steps);
+  return lfsr.state();
+}
+} // namespace detail
+
+/**
+ * a modulo M counter built from an LFSR, as used in hardware where an LFSR is
+ * cheaper than a binary counter: there is no carry chain, only a shift and an
+ * xor of a few bits. the counter goes through M states, starting from the
+ * default state of SmallLFSR<N>, and wraps when reaching the state after M-1
+ * steps (the terminal state). counting is one LFSR step and one comparison.
+ *
+ * the terminal state is computed at compile time. with M = dynamic_modulus,
+ * the modulus is given to the constructor instead and the terminal state is
+ * found by jumping ahead, which is O(N).
+ *
+ * M must be at most 2^N-1, the period of the LFSR.
+ */
+template<std::size_t N, std::uint64_t M = dynamic_modulus>
+class LfsrCounter
+{
+  using LFSR = SmallLFSR<N>;
+  using State = decltype(LFSR{}.state());
+
+  static_assert(N >= 3 && N <= 64);
+  static_assert(M == dynamic_modulus || M <= ~std::uint64_t{} >> (64 - N),
+                "the modulus can not be larger than the period of the LFSR");
+
+  /// only stored when the modulus is given at runtime
+  struct Dynamic
+  {
+    std::uint64_t modulus;
+    State terminal;
+  };
+  struct Empty
+  {};
+
+public:
+  constexpr LfsrCounter()
+    requires(M != dynamic_modulus)
+  = default;
+
+  constexpr explicit LfsrCounter(std::uint64_t modulus)
+    requires(M == dynamic_modulus)
+    : m_dynamic{ modulus, detail::lfsr_state_after<N>(modulus - 1) }
+  {
+    assert(modulus >= 1 && modulus <= ~std::uint64_t{} >> (64 - N));
+  }
+
+  /// counts one step, returns true when wrapping around to the first state
+  constexpr bool next()
+  {
+    const bool wrap = m_lfsr.state() == terminal();
+    LFSR stepped = m_lfsr;
+    stepped.next();
+    // written as a select so there is no branch to mispredict
+    m_lfsr = wrap ? LFSR{} : stepped;
+    return wrap;
+  }
+
+  /// back to the first state
+  constexpr void reset() { m_lfsr = LFSR{}; }
+
+  /// the number of states
+  constexpr std::uint64_t modulus() const
+  {
+    if constexpr (M == dynamic_modulus) {
+      return m_dynamic.modulus;
+    } else {
+      return M;
+    }
+  }
+
+  /// the state just before wrapping
+  constexpr State terminal() const
+  {
+    if constexpr (M == dynamic_modulus) {
+      return m_dynamic.terminal;
+    } else {
+      return StaticTerminal;
+    }
+  }
+
+  /// observe the state. this is not the count, which would have to be found
+  /// with a discrete logarithm.
+  constexpr State state() const { return m_lfsr.state(); }
+
+  /// the size of the shift register
+  static constexpr std::size_t bitcount() { return N; }
+
+private:
+  static constexpr State StaticTerminal =
+    M == dynamic_modulus ? State{} : detail::lfsr_state_after<N>(M - 1);
+
+  LFSR m_lfsr;
+  [[no_unique_address]] std::conditional_t<M == dynamic_modulus,
+                                           Dynamic,
+                                           Empty> m_dynamic{};
+};
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <utility>
+
+namespace detail {
+
+/**
+ * polynomial over GF(2) with degree below 2*N, just enough to compute
+ * x^k modulo the characteristic polynomial of a size N LFSR.
+ * bit i holds the coefficient for x^i.
+ */
+template<std::size_t N>
+struct Gf2Poly
+{
+  static inline constexpr std::size_t WordCount = (2 * N + 63) / 64;
+
+  constexpr bool bit(std::size_t i) const
+  {
+    return (m_words[i / 64] >> (i % 64)) & 0x1;
+  }
+
+  constexpr void flip(std::size_t i)
+  {
+    m_words[i / 64] ^= std::uint64_t{ 1 } << (i % 64);
+  }
+
+  std::array<std::uint64_t, WordCount> m_words{};
+};
+
+/// reduces p modulo the characteristic polynomial of the LFSR, which is
+/// x^N + sum(x^(N-tap)). x^i with i>=N is replaced by sum(x^(i-tap)),
+/// working from the top so bits introduced by the reduction are handled too.
+template<std::size_t N, std::size_t... taps>
+constexpr void
+reduce(Gf2Poly<N>& p, std::index_sequence<taps...>)
+{
+  for (std::size_t i = 2 * N - 1; i >= N; --i) {
+    if (p.bit(i)) {
+      p.flip(i);
+      (p.flip(i - taps), ...);
+    }
+  }
+}
+
+/// squares p (which must have degree below N) and reduces the result
+template<std::size_t N, std::size_t... taps>
+constexpr Gf2Poly<N>
+square(const Gf2Poly<N>& p, std::index_sequence<taps...> seq)
+{
+  // squaring over GF(2) just spreads the bits out, there are no cross terms
+  Gf2Poly<N> ret;
+  for (std::size_t i = 0; i < N; ++i) {
+    if (p.bit(i)) {
+      ret.flip(2 * i);
+    }
+  }
+  reduce<N>(ret, seq);
+  return ret;
+}
+
+/// multiplies p (which must have degree below N) with x and reduces the result
+template<std::size_t N, std::size_t... taps>
+constexpr Gf2Poly<N>
+times_x(const Gf2Poly<N>& p, std::index_sequence<taps...> seq)
+{
+  Gf2Poly<N> ret;
+  std::uint64_t carry = 0;
+  for (std::size_t i = 0; i < p.WordCount; ++i) {
+    ret.m_words[i] = (p.m_words[i] << 1) | carry;
+    carry = p.m_words[i] >> 63;
+  }
+  reduce<N>(ret, seq);
+  return ret;
+}
+
+/**
+ * calculates x^steps modulo the characteristic polynomial of an LFSR of size N
+ * with the given taps. If r is the result and T is the transition done by
+ * next(), T^steps equals r(T) so the state after steps iterations is the sum
+ * of the states after i iterations, for each i where r has a nonzero
+ * coefficient. That means jumping ahead costs O(N) steps regardless of the
+ * distance.
+ */
+template<std::size_t N, std::size_t... taps>
+constexpr Gf2Poly<N>
+jump_polynomial(std::uint64_t steps, std::index_sequence<taps...> seq)
+{
+  Gf2Poly<N> ret;
+  ret.flip(0);
+  // square and multiply, starting from the most significant bit
+  for (int bit = std::bit_width(steps) - 1; bit >= 0; --bit) {
+    ret = square<N>(ret, seq);
+    if ((steps >> bit) & 0x1) {
+      ret = times_x<N>(ret, seq);
+    }
+  }
+  return ret;
+}
+} // namespace detail
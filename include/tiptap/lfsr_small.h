@@ -1,9 +1,15 @@
 #pragma once
 
 #include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
 
 #include "integerselect.h"
 #include "lfsr_coefficients.h"
+#include "lfsr_jump.h"
+#include "output_ranges.h"
 
 /**
  * SmallLFSR is a linear feedback shift register
@@ -22,6 +28,11 @@ template<std::size_t N,
          typename State = SelectInteger_t<N>>
 class SmallLFSR
 {
+public:
+  /// the taps, as an std::index_sequence
+  using Taps = decltype(getTaps<N>());
+
+private:
   /// State, after integer promotion
   using PromotedState = std::common_type_t<State, unsigned>;
 
@@ -54,6 +65,15 @@ class SmallLFSR
   }
 
 public:
+  constexpr SmallLFSR() = default;
+
+  /// starts from the given state, which must not be zero
+  constexpr explicit SmallLFSR(State state)
+    : m_state(state)
+  {
+    assert(state != 0);
+  }
+
   constexpr void next()
   {
     if constexpr (use_direct_top_bit) {
@@ -64,6 +84,53 @@ public:
     }
   }
 
+  /// advances the state as if next() was called steps times. the cost is
+  /// about N calls to next(), independent of steps.
+  constexpr void jump(std::uint64_t steps)
+  {
+    if (steps <= N) {
+      for (std::uint64_t i = 0; i < steps; ++i) {
+        next();
+      }
+      return;
+    }
+    const auto poly = detail::jump_polynomial<N>(steps, getTaps<N>());
+    State sum = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+      if (poly.bit(i)) {
+        sum ^= m_state;
+      }
+      next();
+    }
+    m_state = sum;
+  }
+
+  /// the output bit is the bit shifted out at the bottom on the next step
+  constexpr bool output() const { return m_state & 0x1; }
+
+  /// fills out with the output bits, least significant bit first. advances
+  /// the state 8*out.size() steps.
+  constexpr void generate(std::span<std::byte> out)
+  {
+    for (auto& byte : out) {
+      unsigned value = 0;
+      for (unsigned bit = 0; bit < 8; ++bit) {
+        value |= unsigned{ output() } << bit;
+        next();
+      }
+      byte = std::byte(value);
+    }
+  }
+
+  /// the output from the current state on, as ranges of bits, 64 bit words
+  /// or chunks of words, see output_ranges.h. this lfsr is not advanced.
+  auto bits() const { return OutputBitsView<SmallLFSR>(*this); }
+  auto words() const { return OutputWordsView<SmallLFSR>(*this); }
+  auto chunks() const { return OutputChunksView<SmallLFSR>(*this); }
+
+  /// the size of the shift register
+  static constexpr std::size_t bitcount() { return N; }
+
   /// observe the state
   constexpr State state() const { return m_state; }
 
@@ -0,0 +1,248 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <bitset>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "lfsr_big.h"
+#include "lfsr_small.h"
+#include "shrinking.h"
+
+/**
+ * filter and combination generators, where a nonlinear boolean function is
+ * applied to bits of the state of one LFSR (a filter generator) or to the
+ * outputs of several LFSRs (a combination generator, e.g. Geffe).
+ *
+ * the function is evaluated bitsliced, for 64 consecutive output positions at
+ * once: input i is a word holding the value of variable i at each position,
+ * and the function is the xor of the and of the inputs in each monomial of its
+ * algebraic normal form. for a filter the inputs come from a window of the
+ * LFSR output, since state bit j at time t is the output bit at time t+j, so
+ * the word for a tap j is the 64 output bits starting j positions ahead. this
+ * costs a few word operations per 64 bits, and the rate is close to the one
+ * of the LFSRs themselves.
+ */
+
+/**
+ * a boolean function of K variables. the truth table has f(x) in bit x, where
+ * variable i is bit i of x. the algebraic normal form is the monomials, each
+ * a mask of the variables multiplied, zero being the constant one.
+ */
+template<std::size_t K>
+class BooleanFunction
+{
+  static_assert(K >= 1 && K <= 16);
+
+public:
+  using TruthTable = std::bitset<std::size_t{ 1 } << K>;
+
+  static BooleanFunction from_truth_table(const TruthTable& table)
+  {
+    const TruthTable anf = moebius(table);
+    BooleanFunction ret;
+    ret.m_table = table;
+    for (std::size_t x = 0; x < anf.size(); ++x) {
+      if (anf[x]) {
+        ret.m_monomials.push_back(static_cast<std::uint32_t>(x));
+      }
+    }
+    return ret;
+  }
+
+  static BooleanFunction from_anf(
+    std::initializer_list<std::uint32_t> monomials)
+  {
+    TruthTable anf;
+    for (auto m : monomials) {
+      assert(m < anf.size());
+      anf.flip(m);
+    }
+    return from_truth_table(moebius(anf));
+  }
+
+  /// the value for the variables in the bits of x
+  bool operator()(std::uint32_t x) const { return m_table[x]; }
+
+  /// the value for each bit position of the inputs
+  template<typename Word>
+  Word evaluate(const std::array<Word, K>& inputs) const
+  {
+    Word ret{};
+    for (auto m : m_monomials) {
+      Word term = ~Word{};
+      for (; m != 0; m &= m - 1) {
+        term = term & inputs[std::countr_zero(m)];
+      }
+      ret ^= term;
+    }
+    return ret;
+  }
+
+  const TruthTable& truth_table() const { return m_table; }
+
+  const std::vector<std::uint32_t>& monomials() const { return m_monomials; }
+
+  /// the algebraic degree, the most variables in a monomial
+  unsigned degree() const
+  {
+    unsigned ret = 0;
+    for (auto m : m_monomials) {
+      ret = std::max(ret, static_cast<unsigned>(std::popcount(m)));
+    }
+    return ret;
+  }
+
+private:
+  /// the moebius transform, from the truth table to the anf coefficients.
+  /// it is its own inverse.
+  static TruthTable moebius(TruthTable t)
+  {
+    for (std::size_t i = 0; i < K; ++i) {
+      const std::size_t bit = std::size_t{ 1 } << i;
+      for (std::size_t x = 0; x < t.size(); ++x) {
+        if (x & bit) {
+          t[x] = t[x] ^ t[x ^ bit];
+        }
+      }
+    }
+    return t;
+  }
+
+  TruthTable m_table;
+  std::vector<std::uint32_t> m_monomials;
+};
+
+/// majority of three, x0x1 + x0x2 + x1x2
+inline BooleanFunction<3>
+majority3()
+{
+  return BooleanFunction<3>::from_anf({ 0b011, 0b101, 0b110 });
+}
+
+/// the Geffe combiner, x1 selects x0 or x2: x0x1 + x1x2 + x2
+inline BooleanFunction<3>
+geffe()
+{
+  return BooleanFunction<3>::from_anf({ 0b011, 0b110, 0b100 });
+}
+
+/**
+ * a filter generator: the output at each step is f of K state bits of an
+ * LFSR of size N, where variable i is state bit taps[i] (bit 0 being the
+ * output bit of the LFSR).
+ */
+template<std::size_t N, std::size_t K, typename Limb = std::uint64_t>
+class FilteredLFSR
+{
+public:
+  using LFSR = BigLFSR<N, Limb>;
+
+  FilteredLFSR(const BooleanFunction<K>& function,
+               const std::array<std::size_t, K>& taps,
+               const LFSR& lfsr = LFSR{})
+    : m_function(function)
+    , m_taps(taps)
+    , m_ahead(lfsr)
+  {
+    for (auto tap : taps) {
+      assert(tap < N);
+      static_cast<void>(tap);
+    }
+    for (auto& word : m_window) {
+      word = detail::next_word(m_ahead);
+    }
+  }
+
+  /// fills out with the output bits, least significant bit first. consecutive
+  /// calls continue where the previous left off.
+  void generate(std::span<std::byte> out)
+  {
+    std::size_t pos = m_buffer.drain(out);
+    while (pos < out.size()) {
+      m_buffer.append(next_word(), 64);
+      pos += m_buffer.drain(out.subspan(pos));
+    }
+  }
+
+  const BooleanFunction<K>& function() const { return m_function; }
+
+private:
+  /// enough words to read 64 bits from any tap
+  static constexpr std::size_t WindowWords = (N - 1) / 64 + 2;
+
+  /// the next 64 output bits, and moves the window
+  std::uint64_t next_word()
+  {
+    std::array<std::uint64_t, K> inputs;
+    for (std::size_t i = 0; i < K; ++i) {
+      const std::size_t first = m_taps[i] / 64;
+      const unsigned offset = m_taps[i] % 64;
+      inputs[i] =
+        detail::funnel_shift(m_window[first], m_window[first + 1], offset);
+    }
+    for (std::size_t i = 0; i + 1 < WindowWords; ++i) {
+      m_window[i] = m_window[i + 1];
+    }
+    m_window.back() = detail::next_word(m_ahead);
+    return m_function.evaluate(inputs);
+  }
+
+  BooleanFunction<K> m_function;
+  std::array<std::size_t, K> m_taps;
+  /// the LFSR output from the start of the window on, m_ahead is positioned
+  /// at the end of it
+  std::array<std::uint64_t, WindowWords> m_window;
+  LFSR m_ahead;
+  detail::BitBuffer m_buffer;
+};
+
+/**
+ * a combination generator: the output at each step is f of the output bits of
+ * the registers, register i being variable i. Registers are SmallLFSR or
+ * BigLFSR.
+ */
+template<typename... Registers>
+class CombinedLFSR
+{
+public:
+  static constexpr std::size_t K = sizeof...(Registers);
+
+  explicit CombinedLFSR(const BooleanFunction<K>& function,
+                        const Registers&... registers)
+    : m_function(function)
+    , m_registers(registers...)
+  {
+  }
+
+  /// fills out with the output bits, least significant bit first. consecutive
+  /// calls continue where the previous left off.
+  void generate(std::span<std::byte> out)
+  {
+    std::size_t pos = m_buffer.drain(out);
+    while (pos < out.size()) {
+      const auto inputs = std::apply(
+        [](auto&... r) {
+          return std::array<std::uint64_t, K>{ detail::next_word(r)... };
+        },
+        m_registers);
+      m_buffer.append(m_function.evaluate(inputs), 64);
+      pos += m_buffer.drain(out.subspan(pos));
+    }
+  }
+
+  const BooleanFunction<K>& function() const { return m_function; }
+
+private:
+  BooleanFunction<K> m_function;
+  std::tuple<Registers...> m_registers;
+  detail::BitBuffer m_buffer;
+};
@@ -0,0 +1,264 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <span>
+
+/**
+ * the output of a generator as a range, for use with range based for loops
+ * and std::views:
+ *
+ *   for (bool bit : lfsr.bits() | std::views::take(n)) ...
+ *   for (std::uint64_t word : lfsr.words()) ...
+ *   for (std::span<const std::uint64_t> chunk : lfsr.chunks()) ...
+ *
+ * stepping the generator once per element would keep the compiler from
+ * seeing the bulk loop in generate(). instead the view holds a block of
+ * BlockWords words which it fills with generate(), and the iterators walk
+ * the block with a pointer, so the cost per element is a compare on top of
+ * generating the output.
+ *
+ * the views own a copy of the generator and the block, so the generator
+ * they were made from is not advanced. they are infinite input ranges: each
+ * view can be iterated once, and begin() must only be called once.
+ *
+ * the bit order is the one of generate(): bit i of word j is output bit
+ * 64*j+i. Generator is anything with generate(std::span<std::byte>), like
+ * BigLFSR, SmallLFSR and the generators built from them.
+ */
+
+namespace detail {
+/// the default block, 512 bytes (4 Kibit) of output
+inline constexpr std::size_t default_block_words = 64;
+
+/// a generator and a block of its output
+template<typename Generator, std::size_t BlockWords>
+class OutputBlock
+{
+  static_assert(BlockWords > 0);
+
+public:
+  OutputBlock() requires std::default_initializable<Generator>
+  = default;
+
+  explicit OutputBlock(const Generator& generator)
+    : m_generator(generator)
+  {
+  }
+
+  /// replaces the block with the next output
+  void refill()
+  {
+    // generate into a local copy. the stores of std::byte could alias the
+    // generator in the view, which would make it reload the state after
+    // each byte.
+    Generator generator = m_generator;
+    generator.generate(std::as_writable_bytes(std::span(m_words)));
+    m_generator = generator;
+    if constexpr (std::endian::native == std::endian::big) {
+      // generate() writes the first output in the first byte
+      for (auto& word : m_words) {
+        const auto bytes = std::bit_cast<std::array<std::uint8_t, 8>>(word);
+        word = 0;
+        for (std::size_t i = 0; i < bytes.size(); ++i) {
+          word |= std::uint64_t{ bytes[i] } << (8 * i);
+        }
+      }
+    }
+  }
+
+  const std::uint64_t* begin() const { return m_words.data(); }
+  const std::uint64_t* end() const { return m_words.data() + BlockWords; }
+
+private:
+  Generator m_generator;
+  std::array<std::uint64_t, BlockWords> m_words{};
+};
+}
+
+/// the output as 64 bit words
+template<typename Generator,
+         std::size_t BlockWords = detail::default_block_words>
+class OutputWordsView
+  : public std::ranges::view_interface<OutputWordsView<Generator, BlockWords>>
+{
+  using Block = detail::OutputBlock<Generator, BlockWords>;
+
+public:
+  class iterator
+  {
+  public:
+    using value_type = std::uint64_t;
+    using difference_type = std::ptrdiff_t;
+
+    iterator() = default;
+    explicit iterator(Block* block)
+      : m_block(block)
+      , m_current(block->begin())
+    {
+    }
+
+    std::uint64_t operator*() const { return *m_current; }
+    iterator& operator++()
+    {
+      if (++m_current == m_block->end()) {
+        m_block->refill();
+        m_current = m_block->begin();
+      }
+      return *this;
+    }
+    void operator++(int) { ++*this; }
+    bool operator==(std::default_sentinel_t) const { return false; }
+
+  private:
+    Block* m_block{};
+    const std::uint64_t* m_current{};
+  };
+
+  OutputWordsView() requires std::default_initializable<Generator>
+  = default;
+
+  explicit OutputWordsView(const Generator& generator)
+    : m_block(generator)
+  {
+  }
+
+  iterator begin()
+  {
+    m_block.refill();
+    return iterator(&m_block);
+  }
+  std::default_sentinel_t end() const { return {}; }
+
+private:
+  Block m_block;
+};
+
+/// the output one bit at a time
+template<typename Generator,
+         std::size_t BlockWords = detail::default_block_words>
+class OutputBitsView
+  : public std::ranges::view_interface<OutputBitsView<Generator, BlockWords>>
+{
+  using Block = detail::OutputBlock<Generator, BlockWords>;
+
+public:
+  class iterator
+  {
+  public:
+    using value_type = bool;
+    using difference_type = std::ptrdiff_t;
+
+    iterator() = default;
+    explicit iterator(Block* block)
+      : m_block(block)
+      , m_current(block->begin())
+      , m_word(*m_current)
+    {
+    }
+
+    bool operator*() const { return m_word & 0x1; }
+    iterator& operator++()
+    {
+      m_word >>= 1;
+      if (++m_bit == 64) {
+        if (++m_current == m_block->end()) {
+          m_block->refill();
+          m_current = m_block->begin();
+        }
+        m_word = *m_current;
+        m_bit = 0;
+      }
+      return *this;
+    }
+    void operator++(int) { ++*this; }
+    bool operator==(std::default_sentinel_t) const { return false; }
+
+  private:
+    Block* m_block{};
+    const std::uint64_t* m_current{};
+    /// the remaining bits of *m_current, the current one at the bottom
+    std::uint64_t m_word{};
+    unsigned m_bit{};
+  };
+
+  OutputBitsView() requires std::default_initializable<Generator>
+  = default;
+
+  explicit OutputBitsView(const Generator& generator)
+    : m_block(generator)
+  {
+  }
+
+  iterator begin()
+  {
+    m_block.refill();
+    return iterator(&m_block);
+  }
+  std::default_sentinel_t end() const { return {}; }
+
+private:
+  Block m_block;
+};
+
+/// the output as contiguous chunks of BlockWords words, each valid until the
+/// iterator is incremented. this is the bulk API in range form, for code
+/// which wants to process many words at a time.
+template<typename Generator,
+         std::size_t BlockWords = detail::default_block_words>
+class OutputChunksView
+  : public std::ranges::view_interface<OutputChunksView<Generator, BlockWords>>
+{
+  using Block = detail::OutputBlock<Generator, BlockWords>;
+
+public:
+  using Chunk = std::span<const std::uint64_t, BlockWords>;
+
+  class iterator
+  {
+  public:
+    using value_type = Chunk;
+    using difference_type = std::ptrdiff_t;
+
+    iterator() = default;
+    explicit iterator(Block* block)
+      : m_block(block)
+    {
+    }
+
+    Chunk operator*() const { return Chunk(m_block->begin(), BlockWords); }
+    iterator& operator++()
+    {
+      m_block->refill();
+      return *this;
+    }
+    void operator++(int) { ++*this; }
+    bool operator==(std::default_sentinel_t) const { return false; }
+
+  private:
+    Block* m_block{};
+  };
+
+  OutputChunksView() requires std::default_initializable<Generator>
+  = default;
+
+  explicit OutputChunksView(const Generator& generator)
+    : m_block(generator)
+  {
+  }
+
+  iterator begin()
+  {
+    m_block.refill();
+    return iterator(&m_block);
+  }
+  std::default_sentinel_t end() const { return {}; }
+
+private:
+  Block m_block;
+};
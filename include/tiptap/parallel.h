@@ -0,0 +1,72 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <thread>
+#include <vector>
+
+/**
+ * fills out with the output of lfsr using multiple threads. the result is
+ * byte identical to calling lfsr.generate(out), including the state lfsr is
+ * left in afterwards.
+ *
+ * out is divided into chunks of chunksize bytes. the threads grab the next
+ * unprocessed chunk from a shared counter, so a thread which is slowed down
+ * does not hold up the others. a thread positions itself at the start of the
+ * chunk by jumping ahead from where it was, which is cheap compared to
+ * generating a chunk of reasonable size.
+ *
+ * LFSR needs jump(steps) and generate(span), like BigLFSR.
+ */
+template<typename LFSR>
+void
+parallel_generate(LFSR& lfsr,
+                  std::span<std::byte> out,
+                  unsigned threads = std::thread::hardware_concurrency(),
+                  std::size_t chunksize = std::size_t{ 1 } << 20)
+{
+  if (out.empty()) {
+    return;
+  }
+  chunksize = std::max(chunksize, std::size_t{ 1 });
+  const std::size_t nchunks = (out.size() + chunksize - 1) / chunksize;
+  threads =
+    static_cast<unsigned>(std::clamp<std::size_t>(threads, 1, nchunks));
+
+  if (threads <= 1) {
+    lfsr.generate(out);
+    return;
+  }
+
+  std::atomic<std::size_t> next_chunk{ 0 };
+  auto worker = [&]() {
+    LFSR local = lfsr;
+    // the chunk local is positioned at the start of
+    std::size_t position = 0;
+    for (;;) {
+      const std::size_t chunk = next_chunk.fetch_add(1);
+      if (chunk >= nchunks) {
+        return;
+      }
+      local.jump(std::uint64_t{ chunk - position } * chunksize * 8);
+      const std::size_t begin = chunk * chunksize;
+      local.generate(
+        out.subspan(begin, std::min(chunksize, out.size() - begin)));
+      position = chunk + 1;
+    }
+  };
+
+  {
+    std::vector<std::jthread> pool;
+    pool.reserve(threads - 1);
+    for (unsigned i = 1; i < threads; ++i) {
+      pool.emplace_back(worker);
+    }
+    worker();
+  }
+
+  lfsr.jump(std::uint64_t{ out.size() } * 8);
+}
@@ -0,0 +1,228 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <utility>
+#include <variant>
+
+#include "lfsr_small.h"
+
+/**
+ * visiting the indices of a large array exactly once each, in a scrambled
+ * order, without storing a shuffled index array.
+ *
+ * a maximal length LFSR of size N goes through every nonzero N bit state
+ * exactly once before repeating, so its states are a permutation of
+ * 1..2^N-1. for a bound M, the smallest N with 2^N-1 >= M is used and the
+ * states above M are skipped (cycle walking). since 2^(N-1)-1 < M, at most
+ * about half the steps are skipped.
+ *
+ * consecutive values are related, each one is the previous shifted right one
+ * bit with a new top bit. that scatters accesses over the whole range, which
+ * is what defeats caches and prefetchers, but it is not a random shuffle.
+ */
+
+/// whether a permutation visits 1..M (excluded) or 0..M-1 (included)
+enum class Zero
+{
+  excluded,
+  included
+};
+
+namespace detail {
+
+/// the smallest and largest LFSR sizes used for permutations
+inline constexpr std::size_t MinPermutationOrder = 3;
+inline constexpr std::size_t MaxPermutationOrder = 64;
+
+template<std::size_t... I>
+auto
+small_lfsr_variant(std::index_sequence<I...>)
+  -> std::variant<SmallLFSR<MinPermutationOrder + I>...>;
+
+/// a SmallLFSR of any of the sizes used for permutations, so the size can be
+/// chosen at runtime
+using AnySmallLFSR = decltype(small_lfsr_variant(
+  std::make_index_sequence<MaxPermutationOrder - MinPermutationOrder + 1>{}));
+
+template<std::size_t... I>
+AnySmallLFSR
+make_small_lfsr(std::size_t order, std::index_sequence<I...>)
+{
+  AnySmallLFSR ret;
+  ((order == MinPermutationOrder + I ? (ret.template emplace<I>(), 0) : 0),
+   ...);
+  return ret;
+}
+} // namespace detail
+
+/**
+ * produces the values of a permutation in order. a position in the
+ * permutation is a step of the LFSR, so jumping is cheap, but since out of
+ * range states are skipped a number of steps gives a varying number of values.
+ */
+class PermutationCursor
+{
+public:
+  /// the whole permutation of 1..bound or 0..bound-1
+  PermutationCursor(std::uint64_t bound, Zero zero)
+    : m_bound(bound)
+    , m_shift(zero == Zero::included ? 1 : 0)
+    , m_order(std::max<std::size_t>(detail::MinPermutationOrder,
+                                    std::bit_width(bound)))
+    , m_remaining(bound == 0 ? 0 : period())
+    , m_lfsr(detail::make_small_lfsr(
+        m_order,
+        std::make_index_sequence<detail::MaxPermutationOrder -
+                                 detail::MinPermutationOrder + 1>{}))
+  {
+  }
+
+  /// fills out with the next values, and returns how many were written. that
+  /// is less than out.size() only when the end has been reached.
+  std::size_t generate(std::span<std::uint64_t> out)
+  {
+    std::size_t n = 0;
+    std::visit(
+      [&](auto& lfsr) {
+        while (n < out.size() && m_remaining > 0) {
+          const auto state = static_cast<std::uint64_t>(lfsr.state());
+          lfsr.next();
+          --m_remaining;
+          // branchless, the value is written either way but only kept if it
+          // is in range
+          out[n] = state - m_shift;
+          n += state - 1 < m_bound;
+        }
+      },
+      m_lfsr);
+    return n;
+  }
+
+  /// skips steps positions, or to the end if there are fewer left
+  void jump(std::uint64_t steps)
+  {
+    steps = std::min(steps, m_remaining);
+    std::visit([&](auto& lfsr) { lfsr.jump(steps); }, m_lfsr);
+    m_remaining -= steps;
+  }
+
+  /// stops after steps more positions
+  void truncate(std::uint64_t steps)
+  {
+    m_remaining = std::min(steps, m_remaining);
+  }
+
+  /// true if all values have been produced
+  bool done() const { return m_remaining == 0; }
+
+  /// the number of positions left
+  std::uint64_t remaining() const { return m_remaining; }
+
+  /// the values are below this (included) or at most this (excluded)
+  std::uint64_t bound() const { return m_bound; }
+
+  /// the size of the LFSR
+  std::size_t order() const { return m_order; }
+
+  /// the number of positions in the whole permutation, 2^order-1
+  std::uint64_t period() const
+  {
+    return ~std::uint64_t{} >> (64 - m_order);
+  }
+
+private:
+  std::uint64_t m_bound;
+  std::uint64_t m_shift;
+  std::size_t m_order;
+  std::uint64_t m_remaining;
+  detail::AnySmallLFSR m_lfsr;
+};
+
+/**
+ * a range over a permutation, or a slice of one. the memory use is constant
+ * regardless of the bound.
+ *
+ * iterating visits one value at a time, for speed take a cursor() and
+ * generate values in bulk. to split the work between threads, give each
+ * thread its own slice(i, count).
+ */
+class PermutationView
+{
+public:
+  class iterator
+  {
+  public:
+    using value_type = std::uint64_t;
+    using difference_type = std::ptrdiff_t;
+
+    iterator() = default;
+    explicit iterator(const PermutationCursor& cursor)
+      : m_cursor(cursor)
+    {
+      ++*this;
+    }
+
+    std::uint64_t operator*() const { return m_value; }
+    iterator& operator++()
+    {
+      m_end = m_cursor.generate(std::span(&m_value, 1)) == 0;
+      return *this;
+    }
+    void operator++(int) { ++*this; }
+    bool operator==(std::default_sentinel_t) const { return m_end; }
+
+  private:
+    PermutationCursor m_cursor{ 0, Zero::excluded };
+    std::uint64_t m_value{};
+    bool m_end{ true };
+  };
+
+  explicit PermutationView(const PermutationCursor& cursor)
+    : m_start(cursor)
+  {
+  }
+
+  iterator begin() const { return iterator(m_start); }
+  std::default_sentinel_t end() const { return {}; }
+
+  /// a cursor positioned at the start of the view
+  PermutationCursor cursor() const { return m_start; }
+
+  /// the number of LFSR steps the view covers
+  std::uint64_t steps() const { return m_start.remaining(); }
+
+  /**
+   * part index of count nearly equal parts. the parts are disjoint, and
+   * visiting them in order gives the same values as visiting the view. the
+   * number of values in each part varies somewhat, since out of range states
+   * are skipped.
+   */
+  PermutationView slice(std::uint64_t index, std::uint64_t count) const
+  {
+    const std::uint64_t total = steps();
+    const std::uint64_t base = total / count;
+    const std::uint64_t extra = total % count;
+    PermutationCursor cursor = m_start;
+    cursor.jump(index * base + std::min(index, extra));
+    cursor.truncate(base + (index < extra ? 1 : 0));
+    return PermutationView(cursor);
+  }
+
+private:
+  PermutationCursor m_start;
+};
+
+/**
+ * a permutation of 1..bound, or of 0..bound-1 with Zero::included. any bound
+ * up to 2^64-1 is supported.
+ */
+inline PermutationView
+permutation_view(std::uint64_t bound, Zero zero = Zero::excluded)
+{
+  return PermutationView(PermutationCursor(bound, zero));
+}
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+#include "lfsr_big.h"
+
+/**
+ * irregularly decimated generators, where the output of one LFSR decides
+ * which bits of another (or the same) LFSR are kept.
+ *
+ * rather than branching on every selector bit, 64 selector and data bits are
+ * taken at a time and the kept data bits are gathered with pext, which on x86
+ * with BMI2 is a single instruction. the result is appended to a bit buffer
+ * from which whole bytes are written.
+ */
+
+namespace detail {
+
+/// pext without BMI2: gathers the bits of value selected by mask into the
+/// low bits of the result
+constexpr std::uint64_t
+pext_portable(std::uint64_t value, std::uint64_t mask)
+{
+  std::uint64_t ret = 0;
+  for (std::uint64_t bit = 1; mask != 0; bit <<= 1) {
+    const std::uint64_t lowest = mask & (~mask + 1);
+    ret |= (value & lowest) != 0 ? bit : 0;
+    mask ^= lowest;
+  }
+  return ret;
+}
+
+inline std::uint64_t
+pext(std::uint64_t value, std::uint64_t mask)
+{
+#if defined(__BMI2__)
+  return _pext_u64(value, mask);
+#else
+  return pext_portable(value, mask);
+#endif
+}
+
+/// the next 64 output bits of lfsr, the first one in the least significant
+/// bit
+template<typename LFSR>
+std::uint64_t
+next_word(LFSR& lfsr)
+{
+  std::array<std::byte, 8> bytes;
+  lfsr.generate(bytes);
+  std::uint64_t ret = 0;
+  for (std::size_t i = 0; i < bytes.size(); ++i) {
+    ret |= std::uint64_t(bytes[i]) << (8 * i);
+  }
+  return ret;
+}
+
+/// bits go in at the top and whole bytes come out at the bottom
+class BitBuffer
+{
+public:
+  /// appends the low n bits of value, the bits above n must be zero. there
+  /// must be fewer than 8 bits in the buffer.
+  void append(std::uint64_t value, unsigned n)
+  {
+    m_low |= value << m_count;
+    // the bits that did not fit in m_low. shifting twice avoids shifting by
+    // 64 when m_count is zero.
+    m_high = (value >> 1) >> (63 - m_count);
+    m_count += n;
+  }
+
+  /// the number of bits in the buffer
+  unsigned size() const { return m_count; }
+
+  /// moves as many whole bytes as possible from the buffer to out, and
+  /// returns how many
+  std::size_t drain(std::span<std::byte> out)
+  {
+    std::size_t pos = 0;
+    if (m_count >= 64 && out.size() >= 8) {
+      for (std::size_t i = 0; i < 8; ++i) {
+        out[i] = std::byte(m_low >> (8 * i));
+      }
+      m_low = m_high;
+      m_high = 0;
+      m_count -= 64;
+      pos = 8;
+    }
+    while (m_count >= 8 && pos < out.size()) {
+      out[pos++] = std::byte(m_low);
+      m_low = (m_low >> 8) | (m_high << 56);
+      m_high >>= 8;
+      m_count -= 8;
+    }
+    return pos;
+  }
+
+private:
+  std::uint64_t m_low{};
+  std::uint64_t m_high{};
+  unsigned m_count{};
+};
+} // namespace detail
+
+/**
+ * the shrinking generator (Coppersmith, Krawczyk and Mansour 1993): the
+ * output is the bits of the data LFSR for which the selector LFSR outputs a
+ * one. on average it produces one bit per two steps of each LFSR.
+ */
+template<std::size_t NA, std::size_t NB, typename Limb = std::uint64_t>
+class ShrinkingGenerator
+{
+public:
+  using Selector = BigLFSR<NA, Limb>;
+  using Data = BigLFSR<NB, Limb>;
+
+  explicit ShrinkingGenerator(const Selector& selector = Selector{},
+                              const Data& data = Data{})
+    : m_selector(selector)
+    , m_data(data)
+  {
+  }
+
+  /// fills out with the output bits, least significant bit first. consecutive
+  /// calls continue where the previous left off.
+  void generate(std::span<std::byte> out)
+  {
+    std::size_t pos = m_buffer.drain(out);
+    while (pos < out.size()) {
+      const std::uint64_t select = detail::next_word(m_selector);
+      const std::uint64_t data = detail::next_word(m_data);
+      m_buffer.append(detail::pext(data, select),
+                      static_cast<unsigned>(std::popcount(select)));
+      pos += m_buffer.drain(out.subspan(pos));
+    }
+  }
+
+  const Selector& selector() const { return m_selector; }
+  const Data& data() const { return m_data; }
+
+private:
+  Selector m_selector;
+  Data m_data;
+  detail::BitBuffer m_buffer;
+};
+
+/**
+ * the self-shrinking generator (Meier and Staffelbach 1994): the output of a
+ * single LFSR is taken in pairs, and the second bit of a pair is output if
+ * the first is a one. on average it produces one bit per four steps.
+ */
+template<std::size_t N, typename Limb = std::uint64_t>
+class SelfShrinkingGenerator
+{
+public:
+  using LFSR = BigLFSR<N, Limb>;
+
+  explicit SelfShrinkingGenerator(const LFSR& lfsr = LFSR{})
+    : m_lfsr(lfsr)
+  {
+  }
+
+  /// fills out with the output bits, least significant bit first. consecutive
+  /// calls continue where the previous left off.
+  void generate(std::span<std::byte> out)
+  {
+    constexpr std::uint64_t even = 0x5555'5555'5555'5555;
+    std::size_t pos = m_buffer.drain(out);
+    while (pos < out.size()) {
+      const std::uint64_t word = detail::next_word(m_lfsr);
+      // 32 pairs, the first bit of each selects the second
+      const std::uint64_t select = detail::pext(word, even);
+      const std::uint64_t data = detail::pext(word, even << 1);
+      m_buffer.append(detail::pext(data, select),
+                      static_cast<unsigned>(std::popcount(select)));
+      pos += m_buffer.drain(out.subspan(pos));
+    }
+  }
+
+  const LFSR& lfsr() const { return m_lfsr; }
+
+private:
+  LFSR m_lfsr;
+  detail::BitBuffer m_buffer;
+};
@@ -0,0 +1,277 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "gold_coefficients.h"
+#include "lfsr_big.h"
+
+/**
+ * Gold codes and the small Kasami set, for spread spectrum simulation.
+ *
+ * the codes of a family are the m-sequence u of BigLFSR<N>, its decimation v
+ * (see gold_coefficients.h), and u xor v shifted k chips for every k. a code
+ * is 2^N-1 chips long, packed 64 chips per word with the first chip in the
+ * least significant bit, and the bits after the last chip zero.
+ *
+ * a family is generated in bulk by computing u and v once. the codes are then
+ * the xor of u with v read from a chip offset, which is a few word operations
+ * per 64 chips, so a full family for N=10 is about 16 thousand words and
+ * takes microseconds. to stream a single code instead, use generator(i),
+ * which positions the LFSRs by jumping ahead.
+ */
+
+/**
+ * the chips of one code, as produced by the LFSRs. u and v are stepped
+ * together, v being the LFSR of u jumped q*shift steps and advanced q steps
+ * per chip.
+ */
+template<std::size_t N>
+class SpreadingCodeGenerator
+{
+public:
+  using LFSR = BigLFSR<N, std::uint64_t>;
+  static constexpr std::uint64_t Length = ~std::uint64_t{} >> (64 - N);
+
+  SpreadingCodeGenerator(bool use_u,
+                         bool use_v,
+                         std::uint64_t decimation,
+                         std::uint64_t shift)
+    : m_use_u(use_u)
+    , m_use_v(use_v)
+    , m_decimation(decimation)
+    , m_decimation_jump(LFSR::jump_polynomial(decimation))
+  {
+    m_v.jump(mulmod(decimation % Length, shift % Length));
+  }
+
+  /// the current chip
+  constexpr bool output() const
+  {
+    return (m_use_u && m_u.output()) != (m_use_v && m_v.output());
+  }
+
+  constexpr void next()
+  {
+    m_u.next();
+    if (m_decimation <= N) {
+      // stepping is cheaper than applying the polynomial, which costs about
+      // N steps
+      m_v.jump(m_decimation);
+    } else {
+      m_v.jump(m_decimation_jump);
+    }
+  }
+
+  /// fills out with the chips, least significant bit first
+  constexpr void generate(std::span<std::byte> out)
+  {
+    for (auto& byte : out) {
+      unsigned value = 0;
+      for (unsigned bit = 0; bit < 8; ++bit) {
+        value |= unsigned{ output() } << bit;
+        next();
+      }
+      byte = std::byte(value);
+    }
+  }
+
+private:
+  /// a*b mod Length, without overflow
+  static constexpr std::uint64_t mulmod(std::uint64_t a, std::uint64_t b)
+  {
+    std::uint64_t ret = 0;
+    for (; b != 0; b >>= 1) {
+      if (b & 0x1) {
+        ret = ret >= Length - a ? ret - (Length - a) : ret + a;
+      }
+      a = a >= Length - a ? a - (Length - a) : a + a;
+    }
+    return ret;
+  }
+
+  LFSR m_u;
+  LFSR m_v;
+  bool m_use_u;
+  bool m_use_v;
+  std::uint64_t m_decimation;
+  /// computed once, rather than for every chip as jump(m_decimation) would
+  detail::Gf2Poly<N> m_decimation_jump;
+};
+
+namespace detail {
+
+/// u and its decimation v by q, packed for reading v from any offset below
+/// its period
+template<std::size_t N>
+class DecimatedPair
+{
+public:
+  static constexpr std::uint64_t Length = ~std::uint64_t{} >> (64 - N);
+  static constexpr std::size_t WordsPerCode = (Length + 63) / 64;
+
+  DecimatedPair(std::uint64_t decimation, std::uint64_t period)
+    : m_u(WordsPerCode)
+    , m_decimation(decimation)
+    , m_period(period)
+  {
+    BigLFSR<N, std::uint64_t> lfsr;
+    std::vector<std::byte> bytes(WordsPerCode * 8);
+    lfsr.generate(bytes);
+    for (std::size_t i = 0; i < bytes.size(); ++i) {
+      m_u[i / 8] |= std::uint64_t(bytes[i]) << (8 * (i % 8));
+    }
+    m_u.back() &= tail_mask();
+
+    // v, long enough to read a whole code starting at any offset below the
+    // period
+    const std::uint64_t bits = period + 64 * WordsPerCode;
+    m_v.resize(bits / 64 + 2);
+    std::uint64_t index = 0;
+    for (std::uint64_t n = 0; n < bits; ++n) {
+      m_v[n / 64] |= std::uint64_t{ u_bit(index) } << (n % 64);
+      index += decimation;
+      while (index >= Length) {
+        index -= Length;
+      }
+    }
+  }
+
+  /// u xor v shifted shift chips, either of them can be left out
+  void code(bool use_u,
+            bool use_v,
+            std::uint64_t shift,
+            std::span<std::uint64_t> out) const
+  {
+    assert(out.size() >= WordsPerCode);
+    assert(shift < m_period);
+    const std::uint64_t u_mask = use_u ? ~std::uint64_t{} : 0;
+    const std::uint64_t v_mask = use_v ? ~std::uint64_t{} : 0;
+    const std::size_t first = shift / 64;
+    const unsigned offset = shift % 64;
+    for (std::size_t w = 0; w < WordsPerCode; ++w) {
+      const std::uint64_t v =
+        detail::funnel_shift(m_v[first + w], m_v[first + w + 1], offset);
+      out[w] = (m_u[w] & u_mask) ^ (v & v_mask);
+    }
+    out[WordsPerCode - 1] &= tail_mask();
+  }
+
+  SpreadingCodeGenerator<N> generator(bool use_u,
+                                      bool use_v,
+                                      std::uint64_t shift) const
+  {
+    return SpreadingCodeGenerator<N>(use_u, use_v, m_decimation, shift);
+  }
+
+private:
+  static constexpr std::uint64_t tail_mask()
+  {
+    return Length % 64 == 0 ? ~std::uint64_t{}
+                            : (std::uint64_t{ 1 } << (Length % 64)) - 1;
+  }
+
+  bool u_bit(std::uint64_t i) const { return (m_u[i / 64] >> (i % 64)) & 0x1; }
+
+  std::vector<std::uint64_t> m_u;
+  std::vector<std::uint64_t> m_v;
+  std::uint64_t m_decimation;
+  std::uint64_t m_period;
+};
+} // namespace detail
+
+/**
+ * the 2^N+1 Gold codes of length 2^N-1. code 0 is u, code 1 is v and code 2+k
+ * is u xor v shifted k chips. N must not be divisible by 4.
+ */
+template<std::size_t N>
+class GoldFamily
+{
+  using Pair = detail::DecimatedPair<N>;
+
+public:
+  static constexpr std::uint64_t Length = Pair::Length;
+  static constexpr std::size_t WordsPerCode = Pair::WordsPerCode;
+  static constexpr std::uint64_t Size = Length + 2;
+
+  GoldFamily()
+    : m_pair(detail::getGoldDecimation<N>(), Length)
+  {
+  }
+
+  /// writes code i to the first WordsPerCode words of out
+  void code(std::uint64_t i, std::span<std::uint64_t> out) const
+  {
+    assert(i < Size);
+    m_pair.code(i != 1, i != 0, i >= 2 ? i - 2 : 0, out);
+  }
+
+  /// writes all codes, code i at out[i * WordsPerCode]
+  void generate(std::span<std::uint64_t> out) const
+  {
+    assert(out.size() >= Size * WordsPerCode);
+    for (std::uint64_t i = 0; i < Size; ++i) {
+      code(i, out.subspan(i * WordsPerCode));
+    }
+  }
+
+  /// streams the chips of code i
+  SpreadingCodeGenerator<N> generator(std::uint64_t i) const
+  {
+    assert(i < Size);
+    return m_pair.generator(i != 1, i != 0, i >= 2 ? i - 2 : 0);
+  }
+
+private:
+  Pair m_pair;
+};
+
+/**
+ * the small Kasami set, 2^(N/2) codes of length 2^N-1. code 0 is u, and code
+ * 1+j is u xor w shifted j chips, where w is the decimation of u by
+ * 2^(N/2)+1. N must be even.
+ */
+template<std::size_t N>
+class KasamiFamily
+{
+  using Pair = detail::DecimatedPair<N>;
+
+public:
+  static constexpr std::uint64_t Length = Pair::Length;
+  static constexpr std::size_t WordsPerCode = Pair::WordsPerCode;
+  static constexpr std::uint64_t Size = std::uint64_t{ 1 } << (N / 2);
+
+  KasamiFamily()
+    : m_pair(detail::getKasamiDecimation<N>(), Size - 1)
+  {
+  }
+
+  /// writes code i to the first WordsPerCode words of out
+  void code(std::uint64_t i, std::span<std::uint64_t> out) const
+  {
+    assert(i < Size);
+    m_pair.code(true, i != 0, i >= 1 ? i - 1 : 0, out);
+  }
+
+  /// writes all codes, code i at out[i * WordsPerCode]
+  void generate(std::span<std::uint64_t> out) const
+  {
+    assert(out.size() >= Size * WordsPerCode);
+    for (std::uint64_t i = 0; i < Size; ++i) {
+      code(i, out.subspan(i * WordsPerCode));
+    }
+  }
+
+  /// streams the chips of code i
+  SpreadingCodeGenerator<N> generator(std::uint64_t i) const
+  {
+    assert(i < Size);
+    return m_pair.generator(true, i != 0, i >= 1 ? i - 1 : 0);
+  }
+
+private:
+  Pair m_pair;
+};
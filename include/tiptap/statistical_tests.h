@@ -0,0 +1,669 @@
+#pragma once
+
+// statistical tests for evaluating generators, mostly following NIST SP
+// 800-22. the tests work on a stream of 64 bit words which is fed to them in
+// pieces, so streams larger than the memory can be tested in one pass. the
+// bits of a word are taken least significant first, which matches the order
+// generate() outputs them.
+//
+// each test has update(words), which for the block based tests must be given
+// whole blocks, merge(other) which adds the result of a test that was fed the
+// data directly following this one, and result(). TestBattery runs all of
+// them, dividing the data between threads.
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// the p-value is uniformly distributed on [0,1] for a good generator. it is
+/// NaN if there is not yet enough data for the test.
+struct TestResult
+{
+  std::string name;
+  double p_value;
+};
+
+namespace detail {
+/// the regularized upper incomplete gamma function Q(a,x), which gives the
+/// p-value of a chi-square statistic x*2 with a*2 degrees of freedom.
+inline double
+igamc(double a, double x)
+{
+  if (x <= 0) {
+    return 1.0;
+  }
+  constexpr int max_iterations = 10'000'000;
+  constexpr double eps = 1e-15;
+  const double prefactor = std::exp(-x + a * std::log(x) - std::lgamma(a));
+  if (x < a + 1) {
+    // series for the lower function P(a,x)
+    double term = 1 / a;
+    double sum = term;
+    for (int n = 1; n < max_iterations; ++n) {
+      term *= x / (a + n);
+      sum += term;
+      if (std::abs(term) < std::abs(sum) * eps) {
+        break;
+      }
+    }
+    return std::max(0.0, 1 - sum * prefactor);
+  }
+  // continued fraction for Q(a,x), with the modified Lentz method
+  constexpr double tiny = 1e-300;
+  double b = x + 1 - a;
+  double c = 1 / tiny;
+  double d = 1 / b;
+  double h = d;
+  for (int i = 1; i < max_iterations; ++i) {
+    const double an = -i * (i - a);
+    b += 2;
+    d = an * d + b;
+    d = std::abs(d) < tiny ? tiny : d;
+    c = b + an / c;
+    c = std::abs(c) < tiny ? tiny : c;
+    d = 1 / d;
+    const double delta = d * c;
+    h *= delta;
+    if (std::abs(delta - 1) < eps) {
+      break;
+    }
+  }
+  return prefactor * h;
+}
+
+/// the p-value of a chi-square test of counts against probabilities
+template<std::size_t Bins>
+double
+chi_square_p_value(const std::array<std::uint64_t, Bins>& counts,
+                   const std::array<double, Bins>& probabilities)
+{
+  std::uint64_t total = 0;
+  for (auto c : counts) {
+    total += c;
+  }
+  double chi2 = 0;
+  for (std::size_t i = 0; i < Bins; ++i) {
+    const double expected = probabilities[i] * static_cast<double>(total);
+    const double diff = static_cast<double>(counts[i]) - expected;
+    chi2 += diff * diff / expected;
+  }
+  return igamc((Bins - 1) / 2.0, chi2 / 2);
+}
+
+constexpr std::uint64_t
+reverse_bits(std::uint64_t x)
+{
+  std::uint64_t ret = 0;
+  for (int i = 0; i < 64; ++i) {
+    ret = (ret << 1) | ((x >> i) & 1);
+  }
+  return ret;
+}
+} // namespace detail
+
+/// the proportion of ones (NIST 2.1)
+class MonobitTest
+{
+public:
+  static constexpr std::size_t words_per_block = 1;
+
+  void update(std::span<const std::uint64_t> words)
+  {
+    for (auto w : words) {
+      m_ones += static_cast<std::uint64_t>(std::popcount(w));
+    }
+    m_bits += 64 * words.size();
+  }
+
+  void merge(const MonobitTest& other)
+  {
+    m_ones += other.m_ones;
+    m_bits += other.m_bits;
+  }
+
+  TestResult result() const
+  {
+    const double n = static_cast<double>(m_bits);
+    const double s = 2.0 * static_cast<double>(m_ones) - n;
+    return { "monobit", std::erfc(std::abs(s) / std::sqrt(2 * n)) };
+  }
+
+private:
+  std::uint64_t m_ones{};
+  std::uint64_t m_bits{};
+};
+
+/// the number of runs of identical bits (NIST 2.3)
+class RunsTest
+{
+public:
+  static constexpr std::size_t words_per_block = 1;
+
+  void update(std::span<const std::uint64_t> words)
+  {
+    for (auto w : words) {
+      if (m_bits > 0) {
+        m_transitions += (w & 1) != m_last_bit;
+      } else {
+        m_first_bit = w & 1;
+      }
+      // bit i differs from bit i+1, for the 63 pairs within the word
+      m_transitions += static_cast<std::uint64_t>(
+        std::popcount((w ^ (w >> 1)) & (~std::uint64_t{} >> 1)));
+      m_ones += static_cast<std::uint64_t>(std::popcount(w));
+      m_last_bit = w >> 63;
+      m_bits += 64;
+    }
+  }
+
+  void merge(const RunsTest& other)
+  {
+    if (other.m_bits == 0) {
+      return;
+    }
+    if (m_bits > 0) {
+      m_transitions += m_last_bit != other.m_first_bit;
+    } else {
+      m_first_bit = other.m_first_bit;
+    }
+    m_transitions += other.m_transitions;
+    m_ones += other.m_ones;
+    m_bits += other.m_bits;
+    m_last_bit = other.m_last_bit;
+  }
+
+  TestResult result() const
+  {
+    const double n = static_cast<double>(m_bits);
+    const double pi = static_cast<double>(m_ones) / n;
+    if (std::abs(pi - 0.5) >= 2 / std::sqrt(n)) {
+      // the monobit test fails badly, so this test is not applicable
+      return { "runs", 0.0 };
+    }
+    const double runs = static_cast<double>(m_transitions) + 1;
+    const double expected = 2 * n * pi * (1 - pi);
+    return { "runs",
+             std::erfc(std::abs(runs - expected) /
+                       (2 * std::sqrt(2 * n) * pi * (1 - pi))) };
+  }
+
+private:
+  std::uint64_t m_ones{};
+  std::uint64_t m_bits{};
+  std::uint64_t m_transitions{};
+  bool m_first_bit{};
+  bool m_last_bit{};
+};
+
+/// the proportion of ones within blocks of 1024 bits (NIST 2.2)
+class BlockFrequencyTest
+{
+public:
+  static constexpr std::size_t words_per_block = 16;
+
+  void update(std::span<const std::uint64_t> words)
+  {
+    for (std::size_t i = 0; i + words_per_block <= words.size();
+         i += words_per_block) {
+      std::int64_t ones = 0;
+      for (std::size_t j = 0; j < words_per_block; ++j) {
+        ones += std::popcount(words[i + j]);
+      }
+      const std::int64_t deviation =
+        ones - std::int64_t{ 32 * words_per_block };
+      m_sum_of_squares += static_cast<std::uint64_t>(deviation * deviation);
+      ++m_blocks;
+    }
+  }
+
+  void merge(const BlockFrequencyTest& other)
+  {
+    m_sum_of_squares += other.m_sum_of_squares;
+    m_blocks += other.m_blocks;
+  }
+
+  TestResult result() const
+  {
+    if (m_blocks == 0) {
+      return { "block frequency", std::numeric_limits<double>::quiet_NaN() };
+    }
+    // chi2 = 4M sum (ones/M - 1/2)^2 = 4/M sum (ones - M/2)^2
+    constexpr double M = 64 * words_per_block;
+    const double chi2 = 4 / M * static_cast<double>(m_sum_of_squares);
+    return { "block frequency",
+             detail::igamc(static_cast<double>(m_blocks) / 2, chi2 / 2) };
+  }
+
+private:
+  std::uint64_t m_sum_of_squares{};
+  std::uint64_t m_blocks{};
+};
+
+/// the frequency of each non-overlapping 8 bit pattern, a poker test with
+/// hands of eight bits
+class PokerTest
+{
+public:
+  static constexpr std::size_t words_per_block = 1;
+
+  void update(std::span<const std::uint64_t> words)
+  {
+    for (auto w : words) {
+      for (int i = 0; i < 64; i += 8) {
+        ++m_counts[(w >> i) & 0xff];
+      }
+    }
+  }
+
+  void merge(const PokerTest& other)
+  {
+    for (std::size_t i = 0; i < m_counts.size(); ++i) {
+      m_counts[i] += other.m_counts[i];
+    }
+  }
+
+  TestResult result() const
+  {
+    std::array<double, 256> probabilities;
+    probabilities.fill(1.0 / 256);
+    if (m_counts == decltype(m_counts){}) {
+      return { "poker", std::numeric_limits<double>::quiet_NaN() };
+    }
+    return { "poker", detail::chi_square_p_value(m_counts, probabilities) };
+  }
+
+private:
+  std::array<std::uint64_t, 256> m_counts{};
+};
+
+/**
+ * the birthday spacings test from diehard. each sample is 512 birthdays in a
+ * year of 2^24 days. the number of repeated spacings between the sorted
+ * birthdays is approximately Poisson distributed with mean 2. the birthdays
+ * are the low and high 24 bits of each 64 bit word, the middle 16 bits are
+ * not used by this test.
+ *
+ * the Poisson distribution is an approximation, with a relative error of
+ * about 2^-12. it becomes detectable after tens of gigabytes.
+ */
+class BirthdaySpacingsTest
+{
+public:
+  static constexpr std::size_t birthdays = 512;
+  static constexpr std::size_t words_per_block = birthdays / 2;
+
+  void update(std::span<const std::uint64_t> words)
+  {
+    std::array<std::uint32_t, birthdays> days;
+    for (std::size_t i = 0; i + words_per_block <= words.size();
+         i += words_per_block) {
+      for (std::size_t j = 0; j < words_per_block; ++j) {
+        days[2 * j] = words[i + j] & 0xffffff;
+        days[2 * j + 1] = static_cast<std::uint32_t>(words[i + j] >> 40);
+      }
+      std::sort(days.begin(), days.end());
+      // the spacings, the first one is from the start of the year
+      for (std::size_t j = birthdays - 1; j > 0; --j) {
+        days[j] -= days[j - 1];
+      }
+      std::sort(days.begin(), days.end());
+      std::size_t repeats = 0;
+      for (std::size_t j = 1; j < birthdays; ++j) {
+        repeats += days[j] == days[j - 1];
+      }
+      ++m_counts[std::min(repeats, m_counts.size() - 1)];
+    }
+  }
+
+  void merge(const BirthdaySpacingsTest& other)
+  {
+    for (std::size_t i = 0; i < m_counts.size(); ++i) {
+      m_counts[i] += other.m_counts[i];
+    }
+  }
+
+  TestResult result() const
+  {
+    std::array<double, 7> probabilities;
+    // Poisson with lambda = birthdays^3/(4*2^24) = 2
+    const double lambda = 2;
+    double tail = 1;
+    double p = std::exp(-lambda);
+    for (std::size_t k = 0; k + 1 < probabilities.size(); ++k) {
+      probabilities[k] = p;
+      tail -= p;
+      p *= lambda / static_cast<double>(k + 1);
+    }
+    probabilities.back() = tail;
+    if (m_counts == decltype(m_counts){}) {
+      return { "birthday spacings", std::numeric_limits<double>::quiet_NaN() };
+    }
+    return { "birthday spacings",
+             detail::chi_square_p_value(m_counts, probabilities) };
+  }
+
+private:
+  /// the number of samples with 0, 1 .. 5 and 6 or more repeats
+  std::array<std::uint64_t, 7> m_counts{};
+};
+
+/// the rank of 32x32 binary matrices (NIST 2.5)
+class BinaryMatrixRankTest
+{
+public:
+  static constexpr std::size_t size = 32;
+  static constexpr std::size_t words_per_block = size * size / 64;
+
+  void update(std::span<const std::uint64_t> words)
+  {
+    for (std::size_t i = 0; i + words_per_block <= words.size();
+         i += words_per_block) {
+      std::array<std::uint32_t, size> rows;
+      for (std::size_t j = 0; j < words_per_block; ++j) {
+        rows[2 * j] = static_cast<std::uint32_t>(words[i + j]);
+        rows[2 * j + 1] = static_cast<std::uint32_t>(words[i + j] >> 32);
+      }
+      const auto r = rank(rows);
+      ++m_counts[r == size ? 0 : r == size - 1 ? 1 : 2];
+    }
+  }
+
+  void merge(const BinaryMatrixRankTest& other)
+  {
+    for (std::size_t i = 0; i < m_counts.size(); ++i) {
+      m_counts[i] += other.m_counts[i];
+    }
+  }
+
+  TestResult result() const
+  {
+    if (m_counts == decltype(m_counts){}) {
+      return { "binary matrix rank",
+               std::numeric_limits<double>::quiet_NaN() };
+    }
+    const double full = probability(size);
+    const double one_less = probability(size - 1);
+    return { "binary matrix rank",
+             detail::chi_square_p_value(
+               m_counts,
+               std::array<double, 3>{ full, one_less, 1 - full - one_less }) };
+  }
+
+private:
+  /// gaussian elimination over GF(2). the rows are eliminated with masks
+  /// instead of branches, since the branches would be unpredictable.
+  static std::size_t rank(std::array<std::uint32_t, size>& rows)
+  {
+    std::size_t rank = 0;
+    for (std::size_t col = 0; col < size && rank < size; ++col) {
+      // the rows from rank and onwards which have a one in this column
+      std::uint32_t candidates = 0;
+      for (std::size_t j = 0; j < size; ++j) {
+        candidates |= ((rows[j] >> col) & 1) << j;
+      }
+      candidates &= ~((std::uint32_t{ 1 } << rank) - 1);
+      if (candidates == 0) {
+        continue;
+      }
+      std::swap(rows[rank], rows[std::countr_zero(candidates)]);
+      const auto pivot = rows[rank];
+      for (std::size_t j = rank + 1; j < size; ++j) {
+        rows[j] ^= pivot & -((rows[j] >> col) & 1);
+      }
+      ++rank;
+    }
+    return rank;
+  }
+
+  /// the probability that a random square matrix has rank r
+  static double probability(std::size_t r)
+  {
+    const double n = size;
+    double p = std::exp2(r * (2 * n - r) - n * n);
+    for (std::size_t i = 0; i < r; ++i) {
+      const double f = 1 - std::exp2(double(i) - n);
+      p *= f * f / (1 - std::exp2(double(i) - double(r)));
+    }
+    return p;
+  }
+
+  /// the number of matrices with full rank, one less and the rest
+  std::array<std::uint64_t, 3> m_counts{};
+};
+
+/// the linear complexity of blocks of 512 bits, found with the
+/// Berlekamp-Massey algorithm (NIST 2.10). the work is quadratic in the block
+/// size, which makes this by far the slowest of the tests. 512 bits is close
+/// to the smallest block size NIST recommends.
+class LinearComplexityTest
+{
+public:
+  static constexpr std::size_t M = 512;
+  static constexpr std::size_t words_per_block = M / 64;
+
+  void update(std::span<const std::uint64_t> words)
+  {
+    // the mean for even M, leaving out a term of order M*2^-M
+    constexpr double mu = M / 2.0 + 8.0 / 36;
+    for (std::size_t i = 0; i + words_per_block <= words.size();
+         i += words_per_block) {
+      const auto L = linear_complexity(words.subspan(i, words_per_block));
+      const double t = static_cast<double>(L) - mu + 2.0 / 9;
+      const auto bin = std::clamp(std::ceil(t + 2.5), 0.0, 6.0);
+      ++m_counts[static_cast<std::size_t>(bin)];
+    }
+  }
+
+  void merge(const LinearComplexityTest& other)
+  {
+    for (std::size_t i = 0; i < m_counts.size(); ++i) {
+      m_counts[i] += other.m_counts[i];
+    }
+  }
+
+  TestResult result() const
+  {
+    if (m_counts == decltype(m_counts){}) {
+      return { "linear complexity", std::numeric_limits<double>::quiet_NaN() };
+    }
+    constexpr std::array<double, 7> probabilities = {
+      1.0 / 96, 1.0 / 32, 1.0 / 8, 1.0 / 2, 1.0 / 4, 1.0 / 16, 1.0 / 48
+    };
+    return { "linear complexity",
+             detail::chi_square_p_value(m_counts, probabilities) };
+  }
+
+  /// the length of the shortest LFSR generating the block
+  static std::size_t linear_complexity(std::span<const std::uint64_t> block)
+  {
+    // enough words for a polynomial of degree M
+    constexpr std::size_t W = words_per_block + 1;
+    // the bits in reverse order, so that the discrepancy at step n is the
+    // parity of the connection polynomial and the reversed bits shifted by
+    // M-1-n. all 64 bit offsets are prepared, so the words can be used as is.
+    std::array<std::uint64_t, W + 1> reversed{};
+    for (std::size_t w = 0; w < words_per_block; ++w) {
+      reversed[w] = detail::reverse_bits(block[words_per_block - 1 - w]);
+    }
+    std::array<std::array<std::uint64_t, W>, 64> shifted;
+    for (std::size_t w = 0; w < W; ++w) {
+      shifted[0][w] = reversed[w];
+      for (std::size_t s = 1; s < 64; ++s) {
+        shifted[s][w] = (reversed[w] >> s) | (reversed[w + 1] << (64 - s));
+      }
+    }
+
+    // the connection polynomial c, and the previous one b multiplied by x to
+    // the power of the number of steps since it was replaced
+    std::array<std::uint64_t, W> c{};
+    std::array<std::uint64_t, W> bx{};
+    c[0] = 1;
+    bx[0] = 2;
+    std::size_t L = 0;
+    for (std::size_t n = 0; n < M; ++n) {
+      const std::size_t k = M - 1 - n;
+      const auto& window = shifted[k % 64];
+      std::uint64_t acc = 0;
+      for (std::size_t w = 0; w <= L / 64; ++w) {
+        acc ^= c[w] & window[k / 64 + w];
+      }
+      // the discrepancy is random for random data, so branches would be
+      // mispredicted half of the time. the update is done with masks instead.
+      const std::uint64_t update = -(std::uint64_t(std::popcount(acc)) & 1);
+      const std::uint64_t replace = 2 * L <= n ? update : 0;
+      L = replace ? n + 1 - L : L;
+      // c ^= bx, bx is replaced by the old c if L changed, then bx *= x.
+      // c and bx have degree at most n+1.
+      const std::size_t used = (n + 1) / 64 + 1;
+      std::uint64_t carry = 0;
+      for (std::size_t w = 0; w < used; ++w) {
+        const auto old_c = c[w];
+        const auto b = (bx[w] & ~replace) | (old_c & replace);
+        c[w] = old_c ^ (bx[w] & update);
+        bx[w] = (b << 1) | carry;
+        carry = b >> 63;
+      }
+      if (used < W) {
+        bx[used] = carry;
+      }
+    }
+    return L;
+  }
+
+private:
+  std::array<std::uint64_t, 7> m_counts{};
+};
+
+/**
+ * runs all the tests over the same stream. the data is processed in groups
+ * of group_words words, which is a whole number of blocks for every test. a
+ * call to update() divides the groups between the threads, each of which
+ * runs all the tests on its contiguous part and the results are merged in
+ * order afterwards, so the result does not depend on the number of threads.
+ *
+ * words which do not make up a whole group are kept until the next call to
+ * update(). results() can be called at any time, to get the p-values for the
+ * data so far.
+ */
+class TestBattery
+{
+public:
+  static constexpr std::size_t group_words = 256;
+
+  explicit TestBattery(unsigned threads = std::thread::hardware_concurrency())
+    : m_threads(std::max(threads, 1U))
+  {
+  }
+
+  void update(std::span<const std::uint64_t> words)
+  {
+    if (!m_pending.empty()) {
+      const auto n = std::min(group_words - m_pending.size(), words.size());
+      m_pending.insert(m_pending.end(), words.begin(), words.begin() + n);
+      words = words.subspan(n);
+      if (m_pending.size() < group_words) {
+        return;
+      }
+      m_tests.update(m_pending);
+      m_pending.clear();
+    }
+    const auto whole = words.size() - words.size() % group_words;
+    process(words.first(whole));
+    m_pending.assign(words.begin() + whole, words.end());
+  }
+
+  std::vector<TestResult> results() const { return m_tests.results(); }
+
+  /// true if no p-value is below alpha. tests without enough data for a
+  /// p-value are not counted.
+  static bool passed(const std::vector<TestResult>& results, double alpha)
+  {
+    for (const auto& r : results) {
+      if (r.p_value < alpha) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+private:
+  struct Tests
+  {
+    void update(std::span<const std::uint64_t> words)
+    {
+      monobit.update(words);
+      runs.update(words);
+      block_frequency.update(words);
+      poker.update(words);
+      birthday_spacings.update(words);
+      binary_matrix_rank.update(words);
+      linear_complexity.update(words);
+    }
+    void merge(const Tests& other)
+    {
+      monobit.merge(other.monobit);
+      runs.merge(other.runs);
+      block_frequency.merge(other.block_frequency);
+      poker.merge(other.poker);
+      birthday_spacings.merge(other.birthday_spacings);
+      binary_matrix_rank.merge(other.binary_matrix_rank);
+      linear_complexity.merge(other.linear_complexity);
+    }
+    std::vector<TestResult> results() const
+    {
+      return { monobit.result(),           runs.result(),
+               block_frequency.result(),   poker.result(),
+               birthday_spacings.result(), binary_matrix_rank.result(),
+               linear_complexity.result() };
+    }
+    MonobitTest monobit;
+    RunsTest runs;
+    BlockFrequencyTest block_frequency;
+    PokerTest poker;
+    BirthdaySpacingsTest birthday_spacings;
+    BinaryMatrixRankTest binary_matrix_rank;
+    LinearComplexityTest linear_complexity;
+  };
+  static_assert(group_words % BlockFrequencyTest::words_per_block == 0 &&
+                group_words % BirthdaySpacingsTest::words_per_block == 0 &&
+                group_words % BinaryMatrixRankTest::words_per_block == 0 &&
+                group_words % LinearComplexityTest::words_per_block == 0);
+
+  void process(std::span<const std::uint64_t> words)
+  {
+    // starting threads is not worth it for small amounts of data
+    constexpr std::size_t min_groups_per_thread = 64;
+    const std::size_t groups = words.size() / group_words;
+    const auto threads = std::clamp<std::size_t>(
+      groups / min_groups_per_thread, 1, m_threads);
+    if (threads == 1) {
+      m_tests.update(words);
+      return;
+    }
+    std::vector<Tests> parts(threads);
+    {
+      std::vector<std::jthread> pool;
+      pool.reserve(threads);
+      for (std::size_t i = 0; i < threads; ++i) {
+        const auto begin = groups * i / threads * group_words;
+        const auto end = groups * (i + 1) / threads * group_words;
+        const auto part = words.subspan(begin, end - begin);
+        pool.emplace_back([&parts, i, part]() { parts[i].update(part); });
+      }
+    }
+    for (const auto& part : parts) {
+      m_tests.merge(part);
+    }
+  }
+
+  unsigned m_threads;
+  Tests m_tests;
+  std::vector<std::uint64_t> m_pending;
+};
@@ -0,0 +1,228 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <utility>
+
+#include "lfsr_jump.h"
+
+/**
+ * combined Tausworthe generators by Pierre L'Ecuyer, see "Maximally
+ * equidistributed combined Tausworthe generators" (Math. Comp. 65, 1996) and
+ * "Tables of maximally equidistributed combined LFSR generators" (Math. Comp.
+ * 68, 1999).
+ *
+ * each component is an LFSR with the characteristic polynomial x^k + x^q + 1,
+ * kept in the k most significant bits of a word. a call advances it s bits at
+ * once with a few shifts and masks, and the output is the xor of the
+ * components.
+ */
+
+/**
+ * one component. UInt is the word type, the LFSR has the characteristic
+ * polynomial x^k + x^q + 1 and is advanced s bits per call.
+ */
+template<typename UInt, std::size_t k, std::size_t q, std::size_t s>
+class TauswortheComponent
+{
+  static constexpr std::size_t W = std::numeric_limits<UInt>::digits;
+  static_assert(0 < 2 * q && 2 * q < k && k <= W);
+  static_assert(0 < s && s <= k - q);
+
+public:
+  /// the state is in these bits, the others follow from them
+  static constexpr UInt mask = ~UInt{} << (W - k);
+
+  /// the seed must have at least one bit set in mask
+  constexpr explicit TauswortheComponent(UInt seed)
+    : m_z(seed)
+  {
+    assert((seed & mask) != 0);
+  }
+
+  /// advances s bits and returns the word
+  constexpr UInt next()
+  {
+    m_z = step<s>(m_z);
+    return m_z;
+  }
+
+  /// advances as if next() was called steps times. the cost is about k
+  /// single bit steps, independent of steps.
+  constexpr void jump(std::uint64_t steps)
+  {
+    if (steps == 0) {
+      return;
+    }
+    // the jump only gets the bits in mask right. the bits below are the ones
+    // next() leaves, so jump one call short and make the last call for real.
+    --steps;
+    // each call is s bits, split up so the number of bits does not overflow
+    constexpr std::uint64_t max_steps = ~std::uint64_t{} / s;
+    while (steps > 0) {
+      const std::uint64_t n = std::min(steps, max_steps);
+      jump_bits(n * s);
+      steps -= n;
+    }
+    next();
+  }
+
+  /// the word, as last returned by next()
+  constexpr UInt state() const { return m_z; }
+
+  /// the characteristic polynomial as taps, in the convention of
+  /// lfsr_coefficients.h
+  using Taps = std::index_sequence<k, k - q>;
+
+private:
+  /// the bit sequence advanced Bits bits. the result depends only on the
+  /// bits in mask.
+  template<std::size_t Bits>
+  static constexpr UInt step(UInt z)
+  {
+    const UInt b = ((z << q) ^ z) >> (k - Bits);
+    return ((z & mask) << Bits) ^ b;
+  }
+
+  constexpr void jump_bits(std::uint64_t bits)
+  {
+    // see lfsr_jump.h, the state after bits single bit steps is the sum of
+    // the states after i steps for the nonzero coefficients of
+    // x^bits mod (x^k + x^q + 1)
+    const auto poly = detail::jump_polynomial<k>(bits, Taps{});
+    UInt sum = 0;
+    UInt z = m_z & mask;
+    for (std::size_t i = 0; i < k; ++i) {
+      if (poly.bit(i)) {
+        sum ^= z;
+      }
+      z = step<1>(z);
+    }
+    m_z = sum;
+  }
+
+  UInt m_z;
+};
+
+/**
+ * the xor of several components. satisfies the standard library
+ * UniformRandomBitGenerator requirements, and has next() like the other
+ * generators in tiptap.
+ */
+template<typename UInt, typename... Components>
+class CombinedTausworthe
+{
+public:
+  using result_type = UInt;
+
+  /// one seed per component, see TauswortheComponent
+  constexpr explicit CombinedTausworthe(
+    const std::array<UInt, sizeof...(Components)>& seeds)
+    : m_components(make_components(seeds,
+                                   std::index_sequence_for<Components...>{}))
+  {
+  }
+
+  /// the same seed for all components
+  constexpr explicit CombinedTausworthe(UInt seed)
+    : CombinedTausworthe(same_seeds(seed))
+  {
+  }
+
+  constexpr UInt next()
+  {
+    return std::apply([](auto&... c) { return (c.next() ^ ...); },
+                      m_components);
+  }
+
+  constexpr UInt operator()() { return next(); }
+
+  /// advances as if next() was called steps times
+  constexpr void jump(std::uint64_t steps)
+  {
+    std::apply([steps](auto&... c) { (c.jump(steps), ...); }, m_components);
+  }
+
+  static constexpr UInt min() { return 0; }
+  static constexpr UInt max() { return ~UInt{}; }
+
+  constexpr const std::tuple<Components...>& components() const
+  {
+    return m_components;
+  }
+
+private:
+  template<std::size_t... I>
+  static constexpr std::tuple<Components...> make_components(
+    const std::array<UInt, sizeof...(Components)>& seeds,
+    std::index_sequence<I...>)
+  {
+    return { Components(seeds[I])... };
+  }
+
+  static constexpr std::array<UInt, sizeof...(Components)> same_seeds(
+    UInt seed)
+  {
+    std::array<UInt, sizeof...(Components)> ret;
+    ret.fill(seed);
+    return ret;
+  }
+
+  std::tuple<Components...> m_components;
+};
+
+/// taus88, 32 bit output with period about 2^88. the seeds must be larger
+/// than 1, 7 and 15.
+class Taus88
+  : public CombinedTausworthe<std::uint32_t,
+                              TauswortheComponent<std::uint32_t, 31, 13, 12>,
+                              TauswortheComponent<std::uint32_t, 29, 2, 4>,
+                              TauswortheComponent<std::uint32_t, 28, 3, 17>>
+{
+public:
+  using CombinedTausworthe::CombinedTausworthe;
+  constexpr Taus88()
+    : CombinedTausworthe(12345)
+  {
+  }
+};
+
+/// lfsr113, 32 bit output with period about 2^113. the seeds must be larger
+/// than 1, 7, 15 and 127.
+class Lfsr113
+  : public CombinedTausworthe<std::uint32_t,
+                              TauswortheComponent<std::uint32_t, 31, 6, 18>,
+                              TauswortheComponent<std::uint32_t, 29, 2, 2>,
+                              TauswortheComponent<std::uint32_t, 28, 13, 7>,
+                              TauswortheComponent<std::uint32_t, 25, 3, 13>>
+{
+public:
+  using CombinedTausworthe::CombinedTausworthe;
+  constexpr Lfsr113()
+    : CombinedTausworthe(12345)
+  {
+  }
+};
+
+/// lfsr258, 64 bit output with period about 2^258. the seeds must be larger
+/// than 1, 511, 4095, 131071 and 8388607.
+class Lfsr258
+  : public CombinedTausworthe<std::uint64_t,
+                              TauswortheComponent<std::uint64_t, 63, 1, 10>,
+                              TauswortheComponent<std::uint64_t, 55, 24, 5>,
+                              TauswortheComponent<std::uint64_t, 52, 3, 29>,
+                              TauswortheComponent<std::uint64_t, 47, 5, 23>,
+                              TauswortheComponent<std::uint64_t, 41, 3, 8>>
+{
+public:
+  using CombinedTausworthe::CombinedTausworthe;
+  constexpr Lfsr258()
+    : CombinedTausworthe(123456789123456789)
+  {
+  }
+};
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+/**
+ * outcome of verify_period
+ */
+struct PeriodReport
+{
+  /// the period that was verified, 2^N-1
+  std::uint64_t period{};
+  /// how many segments the period was divided into
+  std::uint64_t segments{};
+  /// number of times the start state was seen before the full period
+  std::uint64_t early_returns{};
+  /// number of segments which did not end where the next one starts
+  std::uint64_t broken_segments{};
+
+  bool ok() const { return early_returns == 0 && broken_segments == 0; }
+};
+
+/**
+ * verifies that LFSR has the maximal period 2^N-1, without storing the
+ * visited states.
+ *
+ * the period is divided into segments, each starting at a state obtained by
+ * jumping ahead from the initial state. the threads walk the segments with
+ * next() and verify that the initial state does not show up along the way,
+ * and that each segment ends exactly where the next one starts (the last one
+ * must end at the initial state). together this means the initial state comes
+ * back after 2^N-1 steps and not earlier.
+ *
+ * memory use is O(threads). LFSR needs jump(steps), next() and state(), like
+ * SmallLFSR and BigLFSR, as well as bitcount(). N must be at most 64.
+ */
+template<typename LFSR>
+PeriodReport
+verify_period(unsigned threads = std::thread::hardware_concurrency())
+{
+  constexpr std::size_t N = LFSR::bitcount();
+  static_assert(N <= 64, "the period must fit in 64 bits");
+
+  const LFSR initial;
+  const auto initial_state = initial.state();
+
+  PeriodReport report;
+  report.period = N == 64 ? ~std::uint64_t{} : (std::uint64_t{ 1 } << N) - 1;
+  threads = std::max(threads, 1U);
+  // a few segments per thread evens out the load towards the end
+  report.segments = std::min<std::uint64_t>(report.period, 16 * threads);
+  const std::uint64_t seglength =
+    (report.period + report.segments - 1) / report.segments;
+  report.segments = (report.period + seglength - 1) / seglength;
+
+  std::atomic<std::uint64_t> next_segment{ 0 };
+  std::atomic<std::uint64_t> early_returns{ 0 };
+  std::atomic<std::uint64_t> broken_segments{ 0 };
+
+  auto worker = [&]() {
+    for (;;) {
+      const std::uint64_t segment = next_segment.fetch_add(1);
+      if (segment >= report.segments) {
+        return;
+      }
+      const std::uint64_t begin = segment * seglength;
+      const std::uint64_t end = std::min(begin + seglength, report.period);
+
+      LFSR lfsr = initial;
+      lfsr.jump(begin);
+      std::uint64_t seen = 0;
+      if (begin == 0) {
+        // the very first state is allowed to be the initial one
+        lfsr.next();
+      }
+      for (std::uint64_t i = begin == 0 ? 1 : begin; i < end; ++i) {
+        seen += lfsr.state() == initial_state;
+        lfsr.next();
+      }
+      early_returns += seen;
+
+      LFSR expected_end = initial;
+      expected_end.jump(end == report.period ? 0 : end);
+      if (lfsr.state() != expected_end.state()) {
+        ++broken_segments;
+      }
+    }
+  };
+
+  {
+    std::vector<std::jthread> pool;
+    pool.reserve(threads - 1);
+    for (unsigned i = 1; i < threads; ++i) {
+      pool.emplace_back(worker);
+    }
+    worker();
+  }
+
+  report.early_returns = early_returns;
+  report.broken_segments = broken_segments;
+  return report;
+}
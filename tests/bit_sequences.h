@@ -0,0 +1,36 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+// helpers for the tests of generators which output a bit sequence through
+// generate(), comparing them with reference implementations which produce
+// one bit at a time
+
+/// packs bits into bytes, least significant bit first
+inline std::vector<std::byte>
+pack(const std::vector<bool>& bits)
+{
+  std::vector<std::byte> ret(bits.size() / 8);
+  for (std::size_t i = 0; i < ret.size() * 8; ++i) {
+    ret[i / 8] |= std::byte(bits[i] << (i % 8));
+  }
+  return ret;
+}
+
+/// generates in pieces of varying size, to exercise the bit buffer
+template<typename Generator>
+std::vector<std::byte>
+generate_in_pieces(Generator& generator, std::size_t bytes)
+{
+  std::vector<std::byte> ret(bytes);
+  std::size_t pos = 0;
+  for (std::size_t piece = 0; pos < bytes; piece = (piece + 1) % 20) {
+    const std::size_t n = std::min(piece, bytes - pos);
+    generator.generate(std::span(ret).subspan(pos, n));
+    pos += n;
+  }
+  return ret;
+}
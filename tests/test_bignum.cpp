@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <cstdint>
 
 #include <catch2/catch_test_macros.hpp>
 
@@ -201,6 +202,54 @@ TEST_CASE("a specific bit can be cleared")
   }
 }
 
+namespace {
+/// shifts with shr_one_bit, which uses simd for large states when the
+/// target has it, and compares with shifting bit by bit
+template<int N, typename Limb>
+void
+verify_shift()
+{
+  BigNum<N, Limb> big;
+  std::uint64_t x = 12345;
+  for (std::size_t i = 0; i < big.bitcount(); ++i) {
+    x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+    big.set_bit_to(i, x >> 63);
+  }
+  for (bool top : { true, false, true }) {
+    auto expected = big;
+    for (std::size_t i = 0; i + 1 < big.bitcount(); ++i) {
+      expected.set_bit_to(i, big.ith_bit(i + 1));
+    }
+    expected.set_bit_to(big.bitcount() - 1, top);
+    big.shr_one_bit(top);
+    REQUIRE(big == expected);
+  }
+  REQUIRE(reinterpret_cast<std::uintptr_t>(big.m_data.data()) %
+            alignof(decltype(big)) ==
+          0);
+}
+}
+
+TEST_CASE("large bignums are shifted right one bit")
+{
+  verify_shift<512, std::uint32_t>();
+  verify_shift<520, std::uint32_t>();
+  verify_shift<1024, std::uint64_t>();
+  verify_shift<1000, std::uint64_t>();
+  verify_shift<4096, std::uint32_t>();
+  verify_shift<4096, std::uint64_t>();
+}
+
+TEST_CASE("bits in the upper half of 64 bit limbs")
+{
+  BigNum<128, std::uint64_t> big;
+  big.set_bit_to(40, true);
+  big.set_bit_to(100, true);
+  for (std::size_t i = 0; i < big.bitcount(); ++i) {
+    REQUIRE(big.ith_bit(i) == (i == 40 || i == 100));
+  }
+}
+
 TEST_CASE("a bignum can be right shifted one bit")
 {
   for (int bit : { 25, 78, 79, 1233 }) {
@@ -279,3 +328,103 @@ TEST_CASE("a bignum can be converted to uint64")
     REQUIRE(b == (1ULL << 10) + (1ULL << 50));
   }
 }
+
+namespace {
+template<int N, typename Limb>
+BigNum<N, Limb>
+random_bignum(std::uint64_t seed)
+{
+  BigNum<N, Limb> ret;
+  for (std::size_t i = 0; i < ret.bitcount(); ++i) {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    ret.set_bit_to(i, seed >> 63);
+  }
+  return ret;
+}
+
+/// checks the multi bit operations against bit by bit versions
+template<int N, typename Limb>
+void
+verify_multibit()
+{
+  const auto a = random_bignum<N, Limb>(1);
+  const auto b = random_bignum<N, Limb>(2);
+
+  for (std::size_t k : { 0, 1, 7, 8, 9, 31, 32, 33, 63, 64, 65, N - 1, N }) {
+    if (k > std::size_t(N)) {
+      continue;
+    }
+    auto right = a;
+    right.shr(k);
+    auto left = a;
+    left.shl(k);
+    for (std::size_t i = 0; i < std::size_t(N); ++i) {
+      REQUIRE(right.ith_bit(i) == (i + k < std::size_t(N) && a.ith_bit(i + k)));
+      REQUIRE(left.ith_bit(i) == (i >= k && a.ith_bit(i - k)));
+    }
+    REQUIRE(right.popcount() <= a.popcount());
+    REQUIRE(left.popcount() <= a.popcount());
+  }
+
+  const auto x = a ^ b;
+  const auto y = a & b;
+  const auto z = a | b;
+  for (std::size_t i = 0; i < std::size_t(N); ++i) {
+    REQUIRE(x.ith_bit(i) == (a.ith_bit(i) != b.ith_bit(i)));
+    REQUIRE(y.ith_bit(i) == (a.ith_bit(i) && b.ith_bit(i)));
+    REQUIRE(z.ith_bit(i) == (a.ith_bit(i) || b.ith_bit(i)));
+  }
+
+  for (std::size_t pos : { 0, 1, 5, 8, 31, 32, 60, 64, 100, N - 64 }) {
+    if (pos + 64 > std::size_t(N)) {
+      continue;
+    }
+    const auto word = a.template extract<64>(pos);
+    const auto small = a.template extract<13>(pos);
+    for (std::size_t i = 0; i < 64; ++i) {
+      REQUIRE(((word >> i) & 1) == a.ith_bit(pos + i));
+    }
+    REQUIRE(small == (word & 0x1fff));
+
+    auto c = b;
+    c.template insert<64>(pos, word);
+    auto d = b;
+    d.template insert<13>(pos, ~std::uint64_t{});
+    for (std::size_t i = 0; i < std::size_t(N); ++i) {
+      const bool inside = i >= pos && i < pos + 64;
+      REQUIRE(c.ith_bit(i) == (inside ? a.ith_bit(i) : b.ith_bit(i)));
+      REQUIRE(d.ith_bit(i) == (i >= pos && i < pos + 13 ? true : b.ith_bit(i)));
+    }
+  }
+  // the top bit
+  auto e = b;
+  e.template insert<1>(N - 1, 1);
+  REQUIRE(e.template extract<1>(N - 1) == 1);
+  REQUIRE(e.template extract<3>(N - 3) == (b.template extract<2>(N - 3) | 4));
+}
+
+constexpr auto
+constexpr_multibit()
+{
+  BigNum<200, std::uint64_t> big;
+  big.insert<64>(70, 0xdead'beef'0123'4567);
+  big.shl(10);
+  big.shr(3);
+  return big.extract<64>(77);
+}
+}
+
+TEST_CASE("multi bit operations for all limb widths")
+{
+  verify_multibit<200, std::uint8_t>();
+  verify_multibit<200, std::uint16_t>();
+  verify_multibit<200, std::uint32_t>();
+  verify_multibit<200, std::uint64_t>();
+  verify_multibit<256, std::uint64_t>();
+  verify_multibit<131, std::uint32_t>();
+}
+
+TEST_CASE("multi bit operations are constexpr")
+{
+  static_assert(constexpr_multibit() == 0xdead'beef'0123'4567);
+}
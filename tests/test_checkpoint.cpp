@@ -0,0 +1,288 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "tiptap/checkpoint.h"
+#include "tiptap/lfsr.h"
+
+namespace {
+/// a file in the temporary directory, removed afterwards
+struct TempFile
+{
+  explicit TempFile(const char* name)
+    : path(std::filesystem::temp_directory_path() /
+           (std::string("tiptap_test_checkpoint_") + name))
+  {
+  }
+  ~TempFile() { std::filesystem::remove(path); }
+  std::filesystem::path path;
+};
+
+std::vector<char>
+read_file(const std::filesystem::path& path)
+{
+  std::ifstream in(path, std::ios::binary);
+  return { std::istreambuf_iterator<char>(in),
+           std::istreambuf_iterator<char>() };
+}
+
+void
+write_file(const std::filesystem::path& path, const std::vector<char>& data)
+{
+  std::ofstream out(path, std::ios::binary);
+  out.write(data.data(), static_cast<std::streamsize>(data.size()));
+}
+
+/// generators at different positions
+template<typename LFSR>
+std::vector<LFSR>
+make_bank(std::size_t count)
+{
+  std::vector<LFSR> ret(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    ret[i].jump(i * 1000 + 1);
+  }
+  return ret;
+}
+
+template<typename LFSR>
+bool
+same_states(const std::vector<LFSR>& a, std::span<const LFSR> b)
+{
+  return std::equal(a.begin(),
+                    a.end(),
+                    b.begin(),
+                    b.end(),
+                    [](const LFSR& x, const LFSR& y) {
+                      return x.state() == y.state();
+                    });
+}
+
+template<typename T>
+void
+swap_at(std::vector<char>& data, std::size_t offset)
+{
+  std::reverse(data.begin() + offset, data.begin() + offset + sizeof(T));
+}
+
+/// the file as written by a machine with the other byte order
+template<typename Limb>
+std::vector<char>
+other_byte_order(std::vector<char> data)
+{
+  std::uint32_t tap_count;
+  std::memcpy(&tap_count, data.data() + 32, sizeof(tap_count));
+  std::uint32_t record_bytes;
+  std::memcpy(&record_bytes, data.data() + 28, sizeof(record_bytes));
+  std::uint64_t count;
+  std::memcpy(&count, data.data() + 40, sizeof(count));
+  std::uint64_t payload_offset;
+  std::memcpy(&payload_offset, data.data() + 48, sizeof(payload_offset));
+  const std::size_t limbs = (record_bytes / sizeof(Limb));
+
+  for (std::size_t offset = 8; offset < 40; offset += 4) {
+    swap_at<std::uint32_t>(data, offset);
+  }
+  swap_at<std::uint64_t>(data, 40);
+  swap_at<std::uint64_t>(data, 48);
+  for (std::size_t i = 0; i < tap_count; ++i) {
+    swap_at<std::uint32_t>(data, 56 + 4 * i);
+  }
+  for (std::size_t i = 0; i < count * limbs; ++i) {
+    swap_at<Limb>(data, payload_offset + i * sizeof(Limb));
+  }
+  return data;
+}
+
+template<typename LFSR>
+void
+verify_round_trip(std::size_t count)
+{
+  TempFile file("round_trip");
+  const auto bank = make_bank<LFSR>(count);
+  REQUIRE(save_bank(file.path, std::span<const LFSR>(bank)) ==
+          CheckpointStatus::ok);
+
+  std::vector<LFSR> loaded;
+  REQUIRE(load_bank(file.path, loaded) == CheckpointStatus::ok);
+  REQUIRE(same_states(bank, std::span<const LFSR>(loaded)));
+
+#ifdef TIPTAP_HAS_MMAP
+  MappedBank<LFSR> mapped(file.path);
+  REQUIRE(mapped.status() == CheckpointStatus::ok);
+  REQUIRE(same_states(bank, std::span<const LFSR>(mapped.states())));
+#endif
+}
+}
+
+TEST_CASE("a bank survives saving and loading")
+{
+  verify_round_trip<BigLFSR<19, std::uint8_t>>(1000);
+  verify_round_trip<BigLFSR<64, std::uint64_t>>(1000);
+  verify_round_trip<BigLFSR<128, std::uint32_t>>(1000);
+  // 96 bytes of limbs, padded to 128 for the alignment
+  verify_round_trip<BigLFSR<768, std::uint64_t>>(100);
+  verify_round_trip<BigLFSR<1024, std::uint64_t>>(100);
+  verify_round_trip<SmallLFSR<13>>(1000);
+  verify_round_trip<SmallLFSR<64>>(1000);
+  verify_round_trip<BigLFSR<64, std::uint64_t>>(0);
+}
+
+TEST_CASE("a single generator can be checkpointed")
+{
+  TempFile file("single");
+  BigLFSR<168, std::uint32_t> lfsr;
+  lfsr.jump(123456789);
+  REQUIRE(save_checkpoint(file.path, lfsr) == CheckpointStatus::ok);
+
+  BigLFSR<168, std::uint32_t> restored;
+  REQUIRE(load_checkpoint(file.path, restored) == CheckpointStatus::ok);
+  REQUIRE(restored.state() == lfsr.state());
+  // and continues where the original was
+  lfsr.next();
+  restored.next();
+  REQUIRE(restored.state() == lfsr.state());
+}
+
+TEST_CASE("a file from the other byte order is swapped on load")
+{
+  TempFile file("byte_order");
+  using LFSR = BigLFSR<768, std::uint64_t>;
+  const auto bank = make_bank<LFSR>(50);
+  REQUIRE(save_bank(file.path, std::span<const LFSR>(bank)) ==
+          CheckpointStatus::ok);
+  write_file(file.path, other_byte_order<std::uint64_t>(read_file(file.path)));
+
+  std::vector<LFSR> loaded;
+  REQUIRE(load_bank(file.path, loaded) == CheckpointStatus::ok);
+  REQUIRE(same_states(bank, std::span<const LFSR>(loaded)));
+
+#ifdef TIPTAP_HAS_MMAP
+  // mapping needs the native order
+  MappedBank<LFSR> mapped(file.path);
+  REQUIRE(mapped.status() == CheckpointStatus::foreign_byte_order);
+  REQUIRE(mapped.states().empty());
+#endif
+}
+
+#ifdef TIPTAP_HAS_MMAP
+TEST_CASE("changes to a mapped bank can be written through")
+{
+  TempFile file("write_through");
+  using LFSR = BigLFSR<128, std::uint64_t>;
+  auto bank = make_bank<LFSR>(100);
+  REQUIRE(save_bank(file.path, std::span<const LFSR>(bank)) ==
+          CheckpointStatus::ok);
+
+  {
+    MappedBank<LFSR> mapped(file.path);
+    REQUIRE(mapped.status() == CheckpointStatus::ok);
+    for (auto& lfsr : mapped.states()) {
+      lfsr.jump(5000);
+    }
+  }
+  // a private mapping does not change the file
+  std::vector<LFSR> loaded;
+  REQUIRE(load_bank(file.path, loaded) == CheckpointStatus::ok);
+  REQUIRE(same_states(bank, std::span<const LFSR>(loaded)));
+
+  {
+    MappedBank<LFSR> mapped(file.path, MapMode::write_through);
+    REQUIRE(mapped.status() == CheckpointStatus::ok);
+    for (auto& lfsr : mapped.states()) {
+      lfsr.jump(5000);
+    }
+    REQUIRE(mapped.flush());
+  }
+  for (auto& lfsr : bank) {
+    lfsr.jump(5000);
+  }
+  REQUIRE(load_bank(file.path, loaded) == CheckpointStatus::ok);
+  REQUIRE(same_states(bank, std::span<const LFSR>(loaded)));
+}
+#endif
+
+TEST_CASE("bad checkpoints are rejected")
+{
+  TempFile file("bad");
+  using LFSR = BigLFSR<64, std::uint64_t>;
+  const auto bank = make_bank<LFSR>(10);
+  REQUIRE(save_bank(file.path, std::span<const LFSR>(bank)) ==
+          CheckpointStatus::ok);
+  const auto good = read_file(file.path);
+
+  // another generator
+  {
+    std::vector<BigLFSR<64, std::uint32_t>> limbs;
+    REQUIRE(load_bank(file.path, limbs) == CheckpointStatus::wrong_generator);
+    REQUIRE(limbs.empty());
+    std::vector<BigLFSR<63, std::uint64_t>> size;
+    REQUIRE(load_bank(file.path, size) == CheckpointStatus::wrong_generator);
+    std::vector<SmallLFSR<64>> type;
+    REQUIRE(load_bank(file.path, type) == CheckpointStatus::wrong_generator);
+    std::vector<BigLFSR<64, std::uint64_t, true, std::index_sequence<64, 1>>>
+      taps;
+    REQUIRE(load_bank(file.path, taps) == CheckpointStatus::wrong_generator);
+#ifdef TIPTAP_HAS_MMAP
+    MappedBank<BigLFSR<63, std::uint64_t>> mapped(file.path);
+    REQUIRE(mapped.status() == CheckpointStatus::wrong_generator);
+#endif
+  }
+
+  std::vector<LFSR> loaded;
+
+  // truncated
+  write_file(file.path, std::vector<char>(good.begin(), good.end() - 1));
+  REQUIRE(load_bank(file.path, loaded) == CheckpointStatus::truncated);
+#ifdef TIPTAP_HAS_MMAP
+  REQUIRE(MappedBank<LFSR>(file.path).status() == CheckpointStatus::truncated);
+#endif
+
+  // garbage
+  auto bad = good;
+  bad[0] = 'x';
+  write_file(file.path, bad);
+  REQUIRE(load_bank(file.path, loaded) == CheckpointStatus::not_a_checkpoint);
+#ifdef TIPTAP_HAS_MMAP
+  REQUIRE(MappedBank<LFSR>(file.path).status() ==
+          CheckpointStatus::not_a_checkpoint);
+#endif
+  write_file(file.path, std::vector<char>(10));
+  REQUIRE(load_bank(file.path, loaded) == CheckpointStatus::not_a_checkpoint);
+
+  // a record size no generator of the type has, which must not be used for
+  // sizing the read buffer even if there are no records
+  for (const std::uint64_t count : { 0, 10 }) {
+    for (const std::uint32_t record_bytes : { 0U, 7U, 65U, 0xFFFFFFFFU }) {
+      bad = good;
+      std::memcpy(bad.data() + 28, &record_bytes, sizeof(record_bytes));
+      std::memcpy(bad.data() + 40, &count, sizeof(count));
+      write_file(file.path, bad);
+      REQUIRE(load_bank(file.path, loaded) == CheckpointStatus::wrong_layout);
+#ifdef TIPTAP_HAS_MMAP
+      REQUIRE(MappedBank<LFSR>(file.path).status() ==
+              CheckpointStatus::wrong_layout);
+#endif
+    }
+  }
+
+  // a later version
+  bad = good;
+  bad[12] = 2;
+  write_file(file.path, bad);
+  REQUIRE(load_bank(file.path, loaded) ==
+          CheckpointStatus::unsupported_version);
+
+  // missing
+  std::filesystem::remove(file.path);
+  REQUIRE(load_bank(file.path, loaded) == CheckpointStatus::io_error);
+#ifdef TIPTAP_HAS_MMAP
+  REQUIRE(MappedBank<LFSR>(file.path).status() == CheckpointStatus::io_error);
+#endif
+}
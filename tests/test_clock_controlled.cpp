@@ -0,0 +1,169 @@
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "tiptap/clock_controlled.h"
+
+namespace {
+using R1 = SmallLFSR<19>;
+using R2 = SmallLFSR<22>;
+using R3 = SmallLFSR<23>;
+using Majority =
+  ClockControlledGenerator<MajorityClocking<8, 10, 10>, R1, R2, R3>;
+using StopAndGo =
+  ClockControlledGenerator<StopAndGoClocking<3>, R1, BigLFSR<89>, R3>;
+/// a register with taps which are not the ones from the table
+using Crc32Taps =
+  std::index_sequence<32, 26, 23, 22, 16, 12, 11, 10, 8, 7, 5, 4, 2, 1>;
+using R4 = SmallLFSR<7>;
+using R5 = BigLFSR<32, std::uint32_t, true, Crc32Taps>;
+using CustomTaps = ClockControlledGenerator<StopAndGoClocking<0>, R4, R5>;
+
+bool
+bit(std::uint64_t state, std::size_t i)
+{
+  return (state >> i) & 1;
+}
+
+/// the majority rule written out with branches
+std::vector<bool>
+reference_majority(R1 a, R2 b, R3 c, std::size_t n)
+{
+  std::vector<bool> ret;
+  for (std::size_t i = 0; i < n; ++i) {
+    ret.push_back(a.output() ^ b.output() ^ c.output());
+    const bool x = bit(a.state(), 8);
+    const bool y = bit(b.state(), 10);
+    const bool z = bit(c.state(), 10);
+    const bool majority = (x + y + z) >= 2;
+    if (x == majority) {
+      a.next();
+    }
+    if (y == majority) {
+      b.next();
+    }
+    if (z == majority) {
+      c.next();
+    }
+  }
+  return ret;
+}
+
+std::vector<bool>
+reference_stop_and_go(R1 a, BigLFSR<89> b, R3 c, std::size_t n)
+{
+  std::vector<bool> ret;
+  for (std::size_t i = 0; i < n; ++i) {
+    ret.push_back(a.output() ^ b.output() ^ c.output());
+    if (bit(a.state(), 3)) {
+      b.next();
+      c.next();
+    }
+    a.next();
+  }
+  return ret;
+}
+
+template<typename Generator>
+bool
+same_state(const Generator& a, const Generator& b)
+{
+  return [&]<std::size_t... I>(std::index_sequence<I...>) {
+    return ((std::get<I>(a.registers()).state() ==
+             std::get<I>(b.registers()).state()) &&
+            ...);
+  }(std::make_index_sequence<Generator::RegisterCount>{});
+}
+
+template<typename Generator>
+std::vector<bool>
+outputs(Generator g, std::size_t n)
+{
+  std::vector<bool> ret;
+  for (std::size_t i = 0; i < n; ++i) {
+    ret.push_back(g.output());
+    g.next();
+  }
+  return ret;
+}
+
+/// distinct starting states, like different keys
+template<typename Generator, typename... Registers>
+std::vector<Generator>
+instances(std::size_t count)
+{
+  std::vector<Generator> ret;
+  for (std::size_t i = 0; i < count; ++i) {
+    ret.emplace_back([&] {
+      Registers r;
+      r.jump(1 + i * 1009 + Registers::bitcount());
+      return r;
+    }()...);
+  }
+  return ret;
+}
+
+/// the bitsliced version of a scalar generator
+template<typename Word, typename Generator>
+struct BitslicedOf;
+template<typename Word, typename Rule, typename... Registers>
+struct BitslicedOf<Word, ClockControlledGenerator<Rule, Registers...>>
+{
+  using type = BitslicedClockControlledGenerator<Word, Rule, Registers...>;
+};
+
+template<typename Word, typename Generator>
+void
+verify_bitsliced(const std::vector<Generator>& scalar)
+{
+  using Bitsliced = typename BitslicedOf<Word, Generator>::type;
+  Bitsliced bitsliced(scalar);
+  for (std::size_t i = 0; i < scalar.size(); ++i) {
+    REQUIRE(same_state(bitsliced.lane(i), scalar[i]));
+  }
+
+  const std::size_t steps = 300;
+  std::vector<Word> out(steps);
+  bitsliced.generate(out);
+  for (std::size_t i = 0; i < scalar.size(); ++i) {
+    const auto expected = outputs(scalar[i], steps);
+    for (std::size_t t = 0; t < steps; ++t) {
+      REQUIRE(detail::lane(out[t], i) == expected[t]);
+    }
+    auto stepped = scalar[i];
+    for (std::size_t t = 0; t < steps; ++t) {
+      stepped.next();
+    }
+    REQUIRE(same_state(bitsliced.lane(i), stepped));
+  }
+}
+}
+
+TEST_CASE("majority clocking matches the reference")
+{
+  for (const auto& g : instances<Majority, R1, R2, R3>(10)) {
+    const auto& [a, b, c] = g.registers();
+    REQUIRE(outputs(g, 2000) == reference_majority(a, b, c, 2000));
+  }
+}
+
+TEST_CASE("stop and go clocking matches the reference")
+{
+  for (const auto& g : instances<StopAndGo, R1, BigLFSR<89>, R3>(10)) {
+    const auto& [a, b, c] = g.registers();
+    REQUIRE(outputs(g, 2000) == reference_stop_and_go(a, b, c, 2000));
+  }
+}
+
+TEST_CASE("bitsliced generators match the scalar ones")
+{
+  verify_bitsliced<std::uint64_t>(instances<Majority, R1, R2, R3>(64));
+  verify_bitsliced<std::uint64_t>(instances<Majority, R1, R2, R3>(5));
+  verify_bitsliced<LaneWord<4>>(instances<Majority, R1, R2, R3>(256));
+  verify_bitsliced<LaneWord<8>>(instances<Majority, R1, R2, R3>(300));
+  verify_bitsliced<LaneWord<2>>(
+    instances<StopAndGo, R1, BigLFSR<89>, R3>(128));
+  verify_bitsliced<std::uint64_t>(instances<CustomTaps, R4, R5>(64));
+}
@@ -0,0 +1,106 @@
+#include <bit>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "tiptap/correlation.h"
+#include "tiptap/spreading_codes.h"
+
+namespace {
+bool
+bit(std::span<const std::uint64_t> a, std::uint64_t i)
+{
+  return (a[i / 64] >> (i % 64)) & 1;
+}
+
+std::vector<std::int64_t>
+naive_correlation(std::span<const std::uint64_t> a,
+                  std::span<const std::uint64_t> b,
+                  std::uint64_t length)
+{
+  std::vector<std::int64_t> ret(length);
+  for (std::uint64_t shift = 0; shift < length; ++shift) {
+    for (std::uint64_t i = 0; i < length; ++i) {
+      ret[shift] += bit(a, i) == bit(b, (i + shift) % length) ? 1 : -1;
+    }
+  }
+  return ret;
+}
+
+/// length bits of a simple generator, with the bits after them zero
+std::vector<std::uint64_t>
+bits(std::uint64_t length, std::uint64_t seed)
+{
+  std::vector<std::uint64_t> ret((length + 63) / 64);
+  for (auto& word : ret) {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    word = seed ^ (seed >> 29);
+  }
+  if (length % 64 != 0) {
+    ret.back() &= (std::uint64_t{ 1 } << (length % 64)) - 1;
+  }
+  return ret;
+}
+
+std::set<std::int64_t>
+distinct(const std::vector<std::int64_t>& spectrum)
+{
+  return { spectrum.begin(), spectrum.end() };
+}
+}
+
+TEST_CASE("correlation matches the definition")
+{
+  for (std::uint64_t length : { 1, 2, 63, 64, 65, 127, 128, 200, 1000 }) {
+    const auto a = bits(length, length);
+    const auto b = bits(length, length + 1);
+    const auto expected = naive_correlation(a, b, length);
+    REQUIRE(periodic_correlation(a, b, length) == expected);
+    REQUIRE(periodic_correlation(a, b, length, 1) == expected);
+    REQUIRE(periodic_autocorrelation(a, length) ==
+            naive_correlation(a, a, length));
+  }
+}
+
+TEST_CASE("m-sequences have two valued autocorrelation")
+{
+  const GoldFamily<13> family;
+  std::vector<std::uint64_t> u(GoldFamily<13>::WordsPerCode);
+  family.code(0, u);
+  const auto spectrum = periodic_autocorrelation(u, GoldFamily<13>::Length);
+  const auto summary = summarize(spectrum);
+  REQUIRE(summary.max_value == 8191);
+  REQUIRE(summary.max_shift == 0);
+  REQUIRE(summary.min_value == -1);
+  REQUIRE(summary.min_shift == 1);
+  REQUIRE(summary.max_off_peak == 1);
+  REQUIRE(summary.values ==
+          std::map<std::int64_t, std::uint64_t>{ { -1, 8190 }, { 8191, 1 } });
+}
+
+TEST_CASE("preferred pairs have three valued cross correlation")
+{
+  const GoldFamily<11> family;
+  std::vector<std::uint64_t> u(GoldFamily<11>::WordsPerCode);
+  std::vector<std::uint64_t> v(GoldFamily<11>::WordsPerCode);
+  family.code(0, u);
+  family.code(1, v);
+  const auto spectrum = periodic_correlation(u, v, GoldFamily<11>::Length);
+  // t(11) = 65
+  REQUIRE(distinct(spectrum) == std::set<std::int64_t>{ -65, -1, 63 });
+  REQUIRE(summarize(spectrum).max_off_peak == 65);
+
+  // the shift of the cross correlation is the shift of v in the gold codes
+  std::vector<std::uint64_t> code(GoldFamily<11>::WordsPerCode);
+  for (std::uint64_t shift : { 0, 1, 100, 2046 }) {
+    family.code(2 + shift, code);
+    std::int64_t differing = 0;
+    for (auto word : code) {
+      differing += std::popcount(word);
+    }
+    REQUIRE(spectrum[shift] == 2047 - 2 * differing);
+  }
+}
@@ -0,0 +1,149 @@
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "tiptap/encrypted_counter.h"
+
+TEST_CASE("aes-128 gives the FIPS-197 known answer")
+{
+  const Aes aes;
+  constexpr auto plaintext = "00112233445566778899aabbccddeeff"_128bithex;
+  constexpr auto expected = "69c4e0d86a7b0430d8cdb78070b4c55a"_128bithex;
+  REQUIRE(aes.encrypt(plaintext) == expected);
+
+  // the interleaved version must give the same result for each block
+  M128Array<3> blocks;
+  blocks.fill(to_128bit_register(plaintext));
+  aes.encrypt(blocks);
+  for (const auto& block : blocks) {
+    Aes::SixteenByte actual;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(actual.data()), block);
+    REQUIRE(actual == expected);
+  }
+}
+
+namespace {
+Aes::SixteenByte
+to_bytes(__m128i m)
+{
+  Aes::SixteenByte ret;
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(ret.data()), m);
+  return ret;
+}
+
+Aes::ThirtyTwoByte
+concat(const Aes::SixteenByte& low, const Aes::SixteenByte& high)
+{
+  Aes::ThirtyTwoByte ret;
+  std::copy(low.begin(), low.end(), ret.begin());
+  std::copy(high.begin(), high.end(), ret.begin() + 16);
+  return ret;
+}
+}
+
+TEST_CASE("aes-128 key expansion gives the FIPS-197 schedule")
+{
+  // from the AES-128 example in
+  // https://csrc.nist.gov/files/pubs/fips/197/final/docs/fips-197.pdf
+  constexpr std::array<Aes::SixteenByte, 11> schedule = {
+    "000102030405060708090a0b0c0d0e0f"_128bithex,
+    "d6aa74fdd2af72fadaa678f1d6ab76fe"_128bithex,
+    "b692cf0b643dbdf1be9bc5006830b3fe"_128bithex,
+    "b6ff744ed2c2c9bf6c590cbf0469bf41"_128bithex,
+    "47f7f7bc95353e03f96c32bcfd058dfd"_128bithex,
+    "3caaa3e8a99f9deb50f3af57adf622aa"_128bithex,
+    "5e390f7df7a69296a7553dc10aa31f6b"_128bithex,
+    "14f9701ae35fe28c440adf4d4ea9c026"_128bithex,
+    "47438735a41c65b9e016baf4aebf7ad2"_128bithex,
+    "549932d1f08557681093ed9cbe2c974e"_128bithex,
+    "13111d7fe3944a17f307a78b4d2b30c5"_128bithex,
+  };
+  const Aes aes;
+  REQUIRE(aes.rounds() == 9);
+  for (std::size_t i = 0; i < schedule.size(); ++i) {
+    REQUIRE(to_bytes(aes.round_key(i)) == schedule[i]);
+  }
+}
+
+TEST_CASE("aes-256 gives the FIPS-197 known answer")
+{
+  const Aes aes(concat("000102030405060708090a0b0c0d0e0f"_128bithex,
+                       "101112131415161718191a1b1c1d1e1f"_128bithex));
+  REQUIRE(aes.rounds() == 13);
+  REQUIRE(aes.encrypt("00112233445566778899aabbccddeeff"_128bithex) ==
+          "8ea2b7ca516745bfeafc49904b496089"_128bithex);
+  // the last round key, from the key expansion example for 256 bit keys
+  REQUIRE(to_bytes(aes.round_key(14)) ==
+          "24fc79ccbf0979e9371ac23c6d68de36"_128bithex);
+}
+
+TEST_CASE("aes with fewer rounds")
+{
+  const auto key = "000102030405060708090a0b0c0d0e0f"_128bithex;
+  const auto plaintext = "00112233445566778899aabbccddeeff"_128bithex;
+  for (std::size_t rounds = 1; rounds <= Aes::MaxRounds128; ++rounds) {
+    const Aes aes(key, rounds);
+    // encrypt by hand with the same round keys
+    const Aes full(key);
+    __m128i m = _mm_xor_si128(to_128bit_register(plaintext), full.round_key(0));
+    for (std::size_t round = 1; round <= rounds; ++round) {
+      m = _mm_aesenc_si128(m, full.round_key(round));
+    }
+    m = _mm_aesenclast_si128(m, full.round_key(rounds + 1));
+    REQUIRE(aes.encrypt(plaintext) == to_bytes(m));
+  }
+}
+
+TEST_CASE("encrypted counter encrypts the lfsr states")
+{
+  EncryptedCounter counter;
+  BigLFSR<128, std::uint64_t> lfsr;
+  const Aes aes;
+  for (int i = 0; i < 100; ++i) {
+    lfsr.next();
+    Aes::SixteenByte state;
+    std::memcpy(state.data(), &lfsr, sizeof(state));
+    const auto block = counter.next_block();
+    Aes::SixteenByte actual;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(actual.data()), block);
+    REQUIRE(actual == aes.encrypt(state));
+  }
+}
+
+TEST_CASE("encrypted counter generate is the same as one block at a time")
+{
+  for (std::size_t size : { 0, 1, 15, 16, 17, 127, 128, 129, 1000, 4096 }) {
+    EncryptedCounter bulk;
+    EncryptedCounter serial = bulk;
+
+    std::vector<std::byte> actual(size);
+    bulk.generate(actual);
+
+    const std::size_t nblocks = (size + 15) / 16;
+    std::vector<std::byte> expected(nblocks * 16);
+    for (std::size_t i = 0; i < nblocks; ++i) {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(expected.data() + 16 * i),
+                       serial.next_block());
+    }
+    expected.resize(size);
+
+    REQUIRE(actual == expected);
+    REQUIRE(bulk.counter().state() == serial.counter().state());
+  }
+}
+
+TEST_CASE("encrypted counter with fewer rounds")
+{
+  // not a known answer, but the batched and single block paths must agree
+  EncryptedCounter bulk(Aes("000102030405060708090a0b0c0d0e0f"_128bithex, 3));
+  EncryptedCounter serial = bulk;
+  std::array<std::byte, 128> actual;
+  bulk.generate(actual);
+  for (std::size_t i = 0; i < 8; ++i) {
+    const auto block = serial.next_block();
+    REQUIRE(std::memcmp(actual.data() + 16 * i, &block, 16) == 0);
+  }
+}
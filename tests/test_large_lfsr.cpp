@@ -92,6 +92,28 @@ TEST_CASE("ensure big LSFR is usable in constexpr context")
   static_assert(third != fourth);
 }
 
+namespace {
+template<std::size_t N, typename Limb>
+constexpr auto
+stepped(std::size_t steps)
+{
+  BigLFSR<N, Limb> lfsr;
+  for (std::size_t i = 0; i < steps; ++i) {
+    lfsr.next();
+  }
+  return lfsr.state();
+}
+}
+
+TEST_CASE("large LFSRs step the same at compile time and at run time")
+{
+  // the run time shift uses simd for large states, if the target has it
+  constexpr auto at_compile_time = stepped<1024, std::uint64_t>(1100);
+  REQUIRE(stepped<1024, std::uint64_t>(1100) == at_compile_time);
+  constexpr auto with_small_limbs = stepped<1024, std::uint32_t>(1100);
+  REQUIRE(stepped<1024, std::uint32_t>(1100) == with_small_limbs);
+}
+
 TEST_CASE("a newly constructed bif LSFR has nonzero start")
 {
   CHECK(to_uint64(BigLFSR<12, std::uint8_t>{}.state()) != 0);
@@ -100,3 +122,146 @@ TEST_CASE("a newly constructed bif LSFR has nonzero start")
   CHECK(to_uint64(BigLFSR<12, std::uint32_t>{}.state()) != 0);
   CHECK(to_uint64(BigLFSR<33, std::uint32_t>{}.state()) != 0);
 }
+
+template<std::size_t N, typename Limb>
+void
+test_jump_impl()
+{
+  for (std::uint64_t steps :
+       { 0, 1, 2, 3, int(N) - 1, int(N), int(N) + 1, 2 * int(N) + 17, 1000 }) {
+    BigLFSR<N, Limb> jumped;
+    jumped.jump(steps);
+
+    BigLFSR<N, Limb> reference;
+    for (std::uint64_t i = 0; i < steps; ++i) {
+      reference.next();
+    }
+    REQUIRE(jumped.state() == reference.state());
+  }
+}
+
+template<std::size_t N>
+void
+test_jump()
+{
+  test_jump_impl<N, std::uint8_t>();
+  test_jump_impl<N, std::uint16_t>();
+  test_jump_impl<N, std::uint32_t>();
+  test_jump_impl<N, std::uint64_t>();
+}
+
+TEST_CASE("jumping ahead gives the same state as stepping")
+{
+  test_jump<3>();
+  test_jump<12>();
+  test_jump<17>();
+  test_jump<64>();
+  test_jump<65>();
+  test_jump<168>();
+  test_jump<512>();
+}
+
+TEST_CASE("jumping a full period returns to the start")
+{
+  BigLFSR<31, std::uint32_t> lfsr;
+  lfsr.jump((1ULL << 31) - 1);
+  CHECK(to_uint64(lfsr.state()) == 1);
+
+  BigLFSR<64, std::uint64_t> big;
+  big.jump(~std::uint64_t{});
+  CHECK(to_uint64(big.state()) == 1);
+}
+
+TEST_CASE("substreams line up with the serial output")
+{
+  constexpr std::size_t bytes_per_stream = 100;
+  constexpr std::size_t k = 5;
+
+  BigLFSR<127, std::uint64_t> lfsr;
+  std::vector<std::byte> serial(k * bytes_per_stream);
+  BigLFSR<127, std::uint64_t>{ lfsr }.generate(serial);
+
+  auto streams = lfsr.split(k, bytes_per_stream * 8);
+  REQUIRE(streams.size() == k);
+  for (std::size_t i = 0; i < k; ++i) {
+    REQUIRE(streams[i].state() ==
+            lfsr.substream(i, bytes_per_stream * 8).state());
+    std::vector<std::byte> part(bytes_per_stream);
+    streams[i].generate(part);
+    REQUIRE(std::ranges::equal(
+      part, std::span(serial).subspan(i * bytes_per_stream, bytes_per_stream)));
+  }
+}
+
+/// the taps of the CRC-32 polynomial 0x04C11DB7, x^32 being the register
+using Crc32Taps =
+  std::index_sequence<32, 26, 23, 22, 16, 12, 11, 10, 8, 7, 5, 4, 2, 1>;
+
+/// K taps spread over 1..N, falling
+template<std::size_t N, std::size_t K>
+constexpr auto
+spread_taps()
+{
+  return []<std::size_t... i>(std::index_sequence<i...>) {
+    return std::index_sequence<(N - i * (N - 1) / (K - 1))...>{};
+  }(std::make_index_sequence<K>{});
+}
+
+/// steps BigLFSR with the given taps and compares against shifting a vector
+/// of bits one at a time
+template<std::size_t N, typename Limb, std::size_t... taps>
+void
+test_custom_taps_impl(std::index_sequence<taps...>, std::size_t steps)
+{
+  BigLFSR<N, Limb, true, std::index_sequence<taps...>> lfsr;
+  BigLFSR<N, Limb, false, std::index_sequence<taps...>> indirect;
+  std::vector<bool> reference(N);
+  reference[0] = true;
+  for (std::size_t step = 0; step < steps; ++step) {
+    for (std::size_t j = 0; j < N; ++j) {
+      REQUIRE(lfsr.state().ith_bit(j) == reference[j]);
+    }
+    REQUIRE(indirect.state() == lfsr.state());
+    const bool feedback = (reference[N - taps] ^ ...);
+    reference.erase(reference.begin());
+    reference.push_back(feedback);
+    lfsr.next();
+    indirect.next();
+  }
+}
+
+template<std::size_t N, typename Taps>
+void
+test_custom_taps(std::size_t steps)
+{
+  test_custom_taps_impl<N, std::uint8_t>(Taps{}, steps);
+  test_custom_taps_impl<N, std::uint32_t>(Taps{}, steps);
+  test_custom_taps_impl<N, std::uint64_t>(Taps{}, steps);
+}
+
+TEST_CASE("custom taps step like shifting one bit at a time")
+{
+  test_custom_taps<32, Crc32Taps>(500);
+  test_custom_taps<127, decltype(spread_taps<127, 20>())>(500);
+  test_custom_taps<1024, decltype(spread_taps<1024, 32>())>(2100);
+  // few taps still go through the sparse feedback
+  test_custom_taps<64, std::index_sequence<64, 1>>(200);
+}
+
+TEST_CASE("jumping ahead with custom taps gives the same state as stepping")
+{
+  using Dense = decltype(spread_taps<512, 30>());
+  BigLFSR<512, std::uint64_t, true, Dense> stepped;
+  for (std::uint64_t steps = 0; steps <= 1100; ++steps) {
+    if (steps % 100 == 7) {
+      BigLFSR<512, std::uint64_t, true, Dense> jumped;
+      jumped.jump(steps);
+      REQUIRE(jumped.state() == stepped.state());
+    }
+    stepped.next();
+  }
+
+  BigLFSR<32, std::uint32_t, true, Crc32Taps> crc;
+  crc.jump((1ULL << 32) - 1);
+  CHECK(to_uint64(crc.state()) == 1);
+}
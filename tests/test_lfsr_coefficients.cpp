@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <array>
 
 #include <catch2/catch_test_macros.hpp>
 
@@ -22,3 +23,17 @@ TEST_CASE("coefficients are ok")
   verify_taps(getTaps<3>());
   verify_taps(getTaps<123>());
 }
+
+TEST_CASE("table entries are checked")
+{
+  using Raw = std::array<int, 6>;
+  static_assert(detail::tap_count(Raw{ 5, 3 }) == 2);
+  static_assert(detail::tap_count(Raw{ 6, 5, 4, 3, 2, 1 }) == 6);
+  static_assert(detail::valid_taps(Raw{ 5, 3 }, 5));
+  static_assert(detail::valid_taps(Raw{ 6, 5, 4, 3, 2, 1 }, 6));
+  // too large, too few, not falling, and taps after the end
+  static_assert(!detail::valid_taps(Raw{ 6, 3 }, 5));
+  static_assert(!detail::valid_taps(Raw{ 5 }, 5));
+  static_assert(!detail::valid_taps(Raw{ 5, 3, 4 }, 5));
+  static_assert(!detail::valid_taps(Raw{ 5, 3, 0, 2 }, 5));
+}
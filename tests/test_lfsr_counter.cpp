@@ -0,0 +1,86 @@
+#include <cstdint>
+#include <set>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "tiptap/lfsr_counter.h"
+
+namespace {
+/// the number of steps until next() returns true, checking that the states
+/// before that are distinct
+template<typename Counter>
+std::uint64_t
+steps_to_wrap(Counter& counter)
+{
+  std::set<std::uint64_t> seen;
+  std::uint64_t steps = 1;
+  while (true) {
+    REQUIRE(seen.insert(counter.state()).second);
+    if (counter.next()) {
+      return steps;
+    }
+    ++steps;
+  }
+}
+}
+
+TEST_CASE("lfsr counter wraps after M steps")
+{
+  LfsrCounter<8, 1> one;
+  REQUIRE(steps_to_wrap(one) == 1);
+  REQUIRE(steps_to_wrap(one) == 1);
+
+  LfsrCounter<8, 200> counter;
+  for (int i = 0; i < 3; ++i) {
+    REQUIRE(steps_to_wrap(counter) == 200);
+    REQUIRE(counter.state() == SmallLFSR<8>{}.state());
+  }
+
+  // the full period
+  LfsrCounter<10, 1023> full;
+  REQUIRE(steps_to_wrap(full) == 1023);
+}
+
+TEST_CASE("lfsr counter terminal state is computed at compile time")
+{
+  constexpr LfsrCounter<16, 1000> counter;
+  static_assert(counter.modulus() == 1000);
+  constexpr auto terminal = counter.terminal();
+
+  SmallLFSR<16> lfsr;
+  for (int i = 0; i < 999; ++i) {
+    lfsr.next();
+  }
+  REQUIRE(terminal == lfsr.state());
+
+  // counting is also possible at compile time
+  constexpr bool wrapped = [] {
+    LfsrCounter<5, 3> c;
+    return !c.next() && !c.next() && c.next();
+  }();
+  static_assert(wrapped);
+}
+
+TEST_CASE("lfsr counter with runtime modulus")
+{
+  for (std::uint64_t modulus : { 1, 2, 3, 100, 12345, 65535 }) {
+    LfsrCounter<16> counter(modulus);
+    REQUIRE(counter.modulus() == modulus);
+    REQUIRE(steps_to_wrap(counter) == modulus);
+    REQUIRE(steps_to_wrap(counter) == modulus);
+  }
+
+  // a large modulus, where stepping to the terminal state is not feasible
+  const std::uint64_t modulus = 1'000'000'000'000;
+  LfsrCounter<48> counter(modulus);
+  SmallLFSR<48> lfsr;
+  lfsr.jump(modulus - 1);
+  REQUIRE(counter.terminal() == lfsr.state());
+  REQUIRE(LfsrCounter<48, modulus>{}.terminal() == counter.terminal());
+}
+
+TEST_CASE("lfsr counter is as small as the lfsr")
+{
+  STATIC_REQUIRE(sizeof(LfsrCounter<16, 1000>) == sizeof(SmallLFSR<16>));
+  STATIC_REQUIRE(sizeof(LfsrCounter<64, 1000>) == sizeof(SmallLFSR<64>));
+}
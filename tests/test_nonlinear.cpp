@@ -0,0 +1,135 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "tiptap/nonlinear.h"
+
+#include "bit_sequences.h"
+
+namespace {
+/// the textbook filter generator, evaluating f on the state every step
+template<std::size_t N, std::size_t K>
+std::vector<std::byte>
+reference_filter(const BooleanFunction<K>& f,
+                 const std::array<std::size_t, K>& taps,
+                 BigLFSR<N, std::uint64_t> lfsr,
+                 std::size_t bytes)
+{
+  std::vector<bool> bits;
+  while (bits.size() < 8 * bytes) {
+    std::uint32_t x = 0;
+    for (std::size_t i = 0; i < K; ++i) {
+      x |= std::uint32_t{ lfsr.state().ith_bit(taps[i]) } << i;
+    }
+    bits.push_back(f(x));
+    lfsr.next();
+  }
+  return pack(bits);
+}
+
+template<typename A, typename B, typename C>
+std::vector<std::byte>
+reference_combiner(const BooleanFunction<3>& f,
+                   A a,
+                   B b,
+                   C c,
+                   std::size_t bytes)
+{
+  std::vector<bool> bits;
+  while (bits.size() < 8 * bytes) {
+    bits.push_back(
+      f(a.output() | (std::uint32_t{ b.output() } << 1) |
+        (std::uint32_t{ c.output() } << 2)));
+    a.next();
+    b.next();
+    c.next();
+  }
+  return pack(bits);
+}
+}
+
+TEST_CASE("boolean functions from truth tables and anf")
+{
+  const auto majority = majority3();
+  REQUIRE(majority.truth_table() ==
+          BooleanFunction<3>::TruthTable(0b1110'1000));
+  REQUIRE(majority.degree() == 2);
+
+  // x1 ? x0 : x2
+  const auto g = geffe();
+  for (std::uint32_t x = 0; x < 8; ++x) {
+    REQUIRE(g(x) == ((x & 2) ? (x & 1) != 0 : (x & 4) != 0));
+  }
+
+  // the anf of a truth table gives back the truth table
+  const BooleanFunction<5>::TruthTable table(0x9e37'79b9);
+  const auto f = BooleanFunction<5>::from_truth_table(table);
+  auto g5 = BooleanFunction<5>::from_anf({});
+  REQUIRE(g5.truth_table().none());
+  REQUIRE(g5.degree() == 0);
+  for (std::uint32_t x = 0; x < 32; ++x) {
+    REQUIRE(f(x) == table[x]);
+  }
+
+  // constant one and a single variable
+  REQUIRE(BooleanFunction<2>::from_anf({ 0 }).truth_table().all());
+  REQUIRE(BooleanFunction<2>::from_anf({ 2 }).truth_table() ==
+          BooleanFunction<2>::TruthTable(0b1100));
+}
+
+TEST_CASE("bitsliced evaluation agrees with the truth table")
+{
+  const BooleanFunction<4>::TruthTable table(0b0110'1011'1101'0010);
+  const auto f = BooleanFunction<4>::from_truth_table(table);
+  // bit position x of the inputs holds the variables x
+  std::array<std::uint64_t, 4> inputs{};
+  for (std::uint32_t x = 0; x < 16; ++x) {
+    for (std::size_t i = 0; i < 4; ++i) {
+      inputs[i] |= std::uint64_t{ (x >> i) & 1 } << x;
+    }
+  }
+  REQUIRE(f.evaluate(inputs) == table.to_ullong());
+}
+
+TEST_CASE("filter generator matches the bit by bit version")
+{
+  using LFSR = BigLFSR<127, std::uint64_t>;
+  const BooleanFunction<5>::TruthTable table(0x96a5'3c0f);
+  const auto f = BooleanFunction<5>::from_truth_table(table);
+  // taps at both ends and across the limb boundary
+  const std::array<std::size_t, 5> taps{ 0, 1, 63, 64, 126 };
+  LFSR lfsr;
+  lfsr.jump(1000);
+  const std::size_t bytes = 3000;
+  const auto expected = reference_filter(f, taps, lfsr, bytes);
+
+  FilteredLFSR<127, 5> whole(f, taps, lfsr);
+  std::vector<std::byte> out(bytes);
+  whole.generate(out);
+  REQUIRE(out == expected);
+
+  FilteredLFSR<127, 5> pieces(f, taps, lfsr);
+  REQUIRE(generate_in_pieces(pieces, bytes) == expected);
+}
+
+TEST_CASE("combination generator matches the bit by bit version")
+{
+  const SmallLFSR<17> a;
+  BigLFSR<19, std::uint64_t> b;
+  b.jump(77);
+  const SmallLFSR<23> c;
+  const std::size_t bytes = 3000;
+  for (const auto& f : { geffe(), majority3() }) {
+    const auto expected = reference_combiner(f, a, b, c, bytes);
+    CombinedLFSR whole(f, a, b, c);
+    std::vector<std::byte> out(bytes);
+    whole.generate(out);
+    REQUIRE(out == expected);
+
+    CombinedLFSR pieces(f, a, b, c);
+    REQUIRE(generate_in_pieces(pieces, bytes) == expected);
+  }
+}
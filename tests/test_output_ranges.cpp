@@ -0,0 +1,132 @@
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <ranges>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "tiptap/lfsr.h"
+#include "tiptap/output_ranges.h"
+#include "tiptap/shrinking.h"
+
+static_assert(std::ranges::input_range<OutputBitsView<SmallLFSR<32>>>);
+static_assert(std::ranges::view<OutputWordsView<BigLFSR<128>>>);
+static_assert(std::ranges::view<OutputChunksView<BigLFSR<128>>>);
+static_assert(
+  std::same_as<std::ranges::range_value_t<OutputChunksView<SmallLFSR<7>, 3>>,
+               std::span<const std::uint64_t, 3>>);
+
+namespace {
+/// the first count words of output, from generate()
+template<typename Generator>
+std::vector<std::uint64_t>
+expected_words(Generator generator, std::size_t count)
+{
+  std::vector<std::byte> bytes(count * 8);
+  generator.generate(std::span(bytes));
+  std::vector<std::uint64_t> ret(count);
+  for (std::size_t i = 0; i < bytes.size(); ++i) {
+    ret[i / 8] |= std::uint64_t(bytes[i]) << (8 * (i % 8));
+  }
+  return ret;
+}
+
+template<typename LFSR>
+void
+verify_views(std::size_t count)
+{
+  LFSR lfsr;
+  lfsr.jump(1234);
+  const auto before = lfsr.state();
+  const auto expected = expected_words(lfsr, count);
+
+  std::vector<std::uint64_t> words;
+  std::ranges::copy(lfsr.words() | std::views::take(count),
+                    std::back_inserter(words));
+  REQUIRE(words == expected);
+
+  std::vector<std::uint64_t> bits(count);
+  std::size_t i = 0;
+  for (bool bit : lfsr.bits() | std::views::take(count * 64)) {
+    bits[i / 64] |= std::uint64_t{ bit } << (i % 64);
+    ++i;
+  }
+  REQUIRE(i == count * 64);
+  REQUIRE(bits == expected);
+
+  std::vector<std::uint64_t> chunked;
+  for (auto chunk : lfsr.chunks()) {
+    chunked.insert(chunked.end(), chunk.begin(), chunk.end());
+    if (chunked.size() >= count) {
+      break;
+    }
+  }
+  chunked.resize(count);
+  REQUIRE(chunked == expected);
+
+  // the lfsr the views were made from is not advanced
+  REQUIRE(lfsr.state() == before);
+}
+}
+
+TEST_CASE("the views give the same output as generate")
+{
+  // more than one block, and not a whole number of blocks
+  verify_views<SmallLFSR<7>>(1000);
+  verify_views<SmallLFSR<32>>(150);
+  verify_views<BigLFSR<64, std::uint64_t>>(1000);
+  verify_views<BigLFSR<168, std::uint8_t>>(130);
+  verify_views<BigLFSR<1024, std::uint64_t>>(65);
+}
+
+TEST_CASE("the block size can be chosen")
+{
+  using LFSR = BigLFSR<32, std::uint32_t>;
+  const LFSR lfsr;
+  const auto expected = expected_words(lfsr, 10);
+  std::vector<std::uint64_t> words;
+  std::ranges::copy(OutputWordsView<LFSR, 1>(lfsr) | std::views::take(10),
+                    std::back_inserter(words));
+  REQUIRE(words == expected);
+
+  std::vector<std::uint64_t> chunked;
+  for (auto chunk : OutputChunksView<LFSR, 3>(lfsr) | std::views::take(4)) {
+    REQUIRE(chunk.size() == 3);
+    chunked.insert(chunked.end(), chunk.begin(), chunk.end());
+  }
+  chunked.resize(10);
+  REQUIRE(chunked == expected);
+}
+
+TEST_CASE("the views compose with other views")
+{
+  const SmallLFSR<16> lfsr;
+  // the bits are balanced over the period
+  std::size_t ones = 0;
+  for (auto bit : lfsr.bits() | std::views::take(65535) |
+                    std::views::filter([](bool b) { return b; })) {
+    ones += bit;
+  }
+  REQUIRE(ones == 32768);
+
+  const auto expected = expected_words(lfsr, 3);
+  std::vector<std::uint64_t> low;
+  std::ranges::copy(lfsr.words() | std::views::take(3) |
+                      std::views::transform(
+                        [](std::uint64_t w) { return w & 0xFFFF; }),
+                    std::back_inserter(low));
+  REQUIRE(low == std::vector<std::uint64_t>{ expected[0] & 0xFFFF,
+                                            expected[1] & 0xFFFF,
+                                            expected[2] & 0xFFFF });
+}
+
+TEST_CASE("any generator with generate can be viewed")
+{
+  const ShrinkingGenerator<61, 89> generator;
+  const auto expected = expected_words(generator, 200);
+  std::vector<std::uint64_t> words;
+  std::ranges::copy(OutputWordsView(generator) | std::views::take(200),
+                    std::back_inserter(words));
+  REQUIRE(words == expected);
+}
@@ -0,0 +1,51 @@
+#include <algorithm>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "tiptap/lfsr_big.h"
+#include "tiptap/parallel.h"
+
+template<typename LFSR>
+void
+verify_same_as_serial(std::size_t size,
+                      unsigned threads,
+                      std::size_t chunksize)
+{
+  LFSR serial_lfsr;
+  // start somewhere other than the default state
+  serial_lfsr.jump(12345);
+  LFSR parallel_lfsr = serial_lfsr;
+
+  std::vector<std::byte> serial(size);
+  serial_lfsr.generate(serial);
+
+  std::vector<std::byte> parallel(size);
+  parallel_generate(parallel_lfsr, std::span(parallel), threads, chunksize);
+
+  REQUIRE(serial == parallel);
+  // the state afterwards must also match, so generation can be continued
+  REQUIRE(serial_lfsr.state() == parallel_lfsr.state());
+}
+
+TEST_CASE("parallel generation is identical to serial")
+{
+  for (unsigned threads : { 1, 2, 3, 8 }) {
+    for (std::size_t chunksize : { 1, 7, 64, 1000 }) {
+      verify_same_as_serial<BigLFSR<19, std::uint8_t>>(
+        10'001, threads, chunksize);
+      verify_same_as_serial<BigLFSR<64, std::uint64_t>>(
+        4096, threads, chunksize);
+      verify_same_as_serial<BigLFSR<168, std::uint32_t>>(
+        3000, threads, chunksize);
+    }
+  }
+}
+
+TEST_CASE("parallel generation of nothing does not change the state")
+{
+  BigLFSR<32> lfsr;
+  const auto before = lfsr.state();
+  parallel_generate(lfsr, std::span<std::byte>{}, 4);
+  REQUIRE(lfsr.state() == before);
+}
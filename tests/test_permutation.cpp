@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "tiptap/permutation.h"
+
+namespace {
+std::vector<std::uint64_t>
+collect(const PermutationView& view)
+{
+  std::vector<std::uint64_t> ret;
+  for (auto value : view) {
+    ret.push_back(value);
+  }
+  return ret;
+}
+
+/// generates in bulk, with an awkward buffer size
+std::vector<std::uint64_t>
+collect_bulk(PermutationCursor cursor)
+{
+  std::vector<std::uint64_t> ret;
+  std::vector<std::uint64_t> buffer(13);
+  while (const auto n = cursor.generate(buffer)) {
+    ret.insert(ret.end(), buffer.begin(), buffer.begin() + n);
+  }
+  return ret;
+}
+}
+
+TEST_CASE("permutation visits each value once")
+{
+  for (std::uint64_t bound = 0; bound < 300; ++bound) {
+    for (auto zero : { Zero::excluded, Zero::included }) {
+      const auto view = permutation_view(bound, zero);
+      auto values = collect(view);
+      REQUIRE(values == collect_bulk(view.cursor()));
+
+      REQUIRE(values.size() == bound);
+      std::sort(values.begin(), values.end());
+      std::vector<std::uint64_t> expected(bound);
+      std::iota(expected.begin(),
+                expected.end(),
+                zero == Zero::included ? 0 : 1);
+      REQUIRE(values == expected);
+    }
+  }
+}
+
+TEST_CASE("permutation uses the smallest lfsr")
+{
+  REQUIRE(permutation_view(1).cursor().order() == 3);
+  REQUIRE(permutation_view(7).cursor().order() == 3);
+  REQUIRE(permutation_view(8).cursor().order() == 4);
+  REQUIRE(permutation_view(1'000'000).cursor().order() == 20);
+  REQUIRE(permutation_view(1 << 20).cursor().order() == 21);
+  REQUIRE(permutation_view((1 << 20) - 1).cursor().order() == 20);
+}
+
+TEST_CASE("permutation of a large range")
+{
+  const std::uint64_t bound = (1 << 20) + 3;
+  std::vector<bool> seen(bound);
+  auto cursor = permutation_view(bound, Zero::included).cursor();
+  std::vector<std::uint64_t> buffer(4096);
+  std::uint64_t count = 0;
+  while (const auto n = cursor.generate(buffer)) {
+    for (std::size_t i = 0; i < n; ++i) {
+      REQUIRE(buffer[i] < bound);
+      REQUIRE(!seen[buffer[i]]);
+      seen[buffer[i]] = true;
+    }
+    count += n;
+  }
+  REQUIRE(count == bound);
+}
+
+TEST_CASE("permutation slices cover the view")
+{
+  for (std::uint64_t bound : { 1, 5, 100, 1000 }) {
+    const auto view = permutation_view(bound);
+    const auto whole = collect(view);
+    for (std::uint64_t count : { 1, 2, 7, 64 }) {
+      std::vector<std::uint64_t> joined;
+      for (std::uint64_t i = 0; i < count; ++i) {
+        const auto part = collect_bulk(view.slice(i, count).cursor());
+        joined.insert(joined.end(), part.begin(), part.end());
+      }
+      REQUIRE(joined == whole);
+
+      // slices of slices
+      const auto half = view.slice(1, 2);
+      joined.clear();
+      for (std::uint64_t i = 0; i < count; ++i) {
+        const auto part = collect(half.slice(i, count));
+        joined.insert(joined.end(), part.begin(), part.end());
+      }
+      REQUIRE(joined == collect(half));
+    }
+  }
+}
+
+TEST_CASE("permutation jump matches stepping")
+{
+  const auto view = permutation_view(1'000'000'007, Zero::included);
+  auto stepped = view.cursor();
+  std::vector<std::uint64_t> skipped(100'000);
+  stepped.generate(skipped);
+  const auto steps = view.steps() - stepped.remaining();
+
+  auto jumped = view.cursor();
+  jumped.jump(steps);
+  REQUIRE(jumped.remaining() == stepped.remaining());
+  std::vector<std::uint64_t> a(1000);
+  std::vector<std::uint64_t> b(1000);
+  REQUIRE(stepped.generate(a) == a.size());
+  REQUIRE(jumped.generate(b) == b.size());
+  REQUIRE(a == b);
+
+  // jumping past the end stops there
+  jumped.jump(view.steps());
+  REQUIRE(jumped.done());
+  REQUIRE(jumped.generate(b) == 0);
+}
+
+TEST_CASE("permutation of the full 64 bit range")
+{
+  constexpr auto bound = std::numeric_limits<std::uint64_t>::max();
+  for (auto zero : { Zero::excluded, Zero::included }) {
+    const auto view = permutation_view(bound, zero);
+    REQUIRE(view.cursor().order() == 64);
+    REQUIRE(view.steps() == bound);
+    // every state is in range, so the slices are exact
+    const auto last = view.slice(999, 1000);
+    std::vector<std::uint64_t> values(10);
+    auto cursor = last.cursor();
+    REQUIRE(cursor.generate(values) == values.size());
+    for (auto value : values) {
+      if (zero == Zero::excluded) {
+        REQUIRE(value != 0);
+      } else {
+        REQUIRE(value != bound);
+      }
+    }
+  }
+}
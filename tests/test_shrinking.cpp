@@ -0,0 +1,102 @@
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "tiptap/shrinking.h"
+
+#include "bit_sequences.h"
+
+namespace {
+/// the textbook bit by bit shrinking generator
+template<typename A, typename B>
+std::vector<std::byte>
+reference_shrinking(A a, B b, std::size_t bytes)
+{
+  std::vector<bool> bits;
+  while (bits.size() < 8 * bytes) {
+    if (a.output()) {
+      bits.push_back(b.output());
+    }
+    a.next();
+    b.next();
+  }
+  bits.resize(8 * bytes);
+  return pack(bits);
+}
+
+template<typename LFSR>
+std::vector<std::byte>
+reference_self_shrinking(LFSR lfsr, std::size_t bytes)
+{
+  std::vector<bool> bits;
+  while (bits.size() < 8 * bytes) {
+    const bool select = lfsr.output();
+    lfsr.next();
+    const bool data = lfsr.output();
+    lfsr.next();
+    if (select) {
+      bits.push_back(data);
+    }
+  }
+  bits.resize(8 * bytes);
+  return pack(bits);
+}
+}
+
+TEST_CASE("portable pext")
+{
+  REQUIRE(detail::pext_portable(0, 0) == 0);
+  REQUIRE(detail::pext_portable(~0ULL, 0) == 0);
+  REQUIRE(detail::pext_portable(~0ULL, 0xf0f0) == 0xff);
+  REQUIRE(detail::pext_portable(0b1011'0110, 0b1100'1100) == 0b1001);
+  REQUIRE(detail::pext_portable(0x8000'0000'0000'0001, ~0ULL) ==
+          0x8000'0000'0000'0001);
+  REQUIRE(detail::pext_portable(0x8000'0000'0000'0000, 0x8000'0000'0000'0000) ==
+          1);
+  // agrees with the one in use, which may be the instruction
+  std::uint64_t x = 12345;
+  for (int i = 0; i < 1000; ++i) {
+    x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+    const std::uint64_t value = x;
+    x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+    const std::uint64_t mask = x;
+    REQUIRE(detail::pext(value, mask) == detail::pext_portable(value, mask));
+  }
+}
+
+TEST_CASE("shrinking generator matches the bit by bit version")
+{
+  using Generator = ShrinkingGenerator<61, 89>;
+  Generator::Selector selector;
+  selector.jump(1000);
+  Generator::Data data;
+  const std::size_t bytes = 5000;
+  const auto expected = reference_shrinking(selector, data, bytes);
+
+  Generator whole(selector, data);
+  std::vector<std::byte> out(bytes);
+  whole.generate(out);
+  REQUIRE(out == expected);
+
+  Generator pieces(selector, data);
+  REQUIRE(generate_in_pieces(pieces, bytes) == expected);
+}
+
+TEST_CASE("self-shrinking generator matches the bit by bit version")
+{
+  using Generator = SelfShrinkingGenerator<127>;
+  Generator::LFSR lfsr;
+  lfsr.jump(12345);
+  const std::size_t bytes = 5000;
+  const auto expected = reference_self_shrinking(lfsr, bytes);
+
+  Generator whole(lfsr);
+  std::vector<std::byte> out(bytes);
+  whole.generate(out);
+  REQUIRE(out == expected);
+
+  Generator pieces(lfsr);
+  REQUIRE(generate_in_pieces(pieces, bytes) == expected);
+}
@@ -0,0 +1,152 @@
+#include <bit>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "tiptap/spreading_codes.h"
+
+namespace {
+std::uint64_t
+weight(std::span<const std::uint64_t> code)
+{
+  std::uint64_t ret = 0;
+  for (auto word : code) {
+    ret += static_cast<std::uint64_t>(std::popcount(word));
+  }
+  return ret;
+}
+
+/// the periodic correlation with the all zero shift of u is length minus
+/// twice the number of differing chips, so the weight of u xor (shifted v)
+/// gives the cross correlation of u and v
+template<typename Family>
+std::set<std::int64_t>
+correlations(const Family& family, std::uint64_t first)
+{
+  std::set<std::int64_t> ret;
+  std::vector<std::uint64_t> code(Family::WordsPerCode);
+  for (std::uint64_t i = first; i < Family::Size; ++i) {
+    family.code(i, code);
+    ret.insert(std::int64_t(Family::Length) -
+               2 * std::int64_t(weight(code)));
+  }
+  return ret;
+}
+
+bool
+chip(std::span<const std::uint64_t> code, std::uint64_t i)
+{
+  return (code[i / 64] >> (i % 64)) & 1;
+}
+
+/// the periodic cross correlations of all pairs of codes, at all shifts
+template<typename Family>
+std::set<std::int64_t>
+all_correlations(const Family& family)
+{
+  const auto words = Family::WordsPerCode;
+  std::vector<std::uint64_t> all(Family::Size * words);
+  family.generate(all);
+  std::set<std::int64_t> ret;
+  for (std::uint64_t a = 0; a < Family::Size; ++a) {
+    const auto x = std::span(all).subspan(a * words, words);
+    for (std::uint64_t b = 0; b < Family::Size; ++b) {
+      const auto y = std::span(all).subspan(b * words, words);
+      for (std::uint64_t shift = 0; shift < Family::Length; ++shift) {
+        std::int64_t sum = 0;
+        for (std::uint64_t i = 0; i < Family::Length; ++i) {
+          sum += chip(x, i) == chip(y, (i + shift) % Family::Length) ? 1 : -1;
+        }
+        ret.insert(sum);
+      }
+    }
+  }
+  return ret;
+}
+
+template<std::size_t N>
+void
+verify_gold()
+{
+  const GoldFamily<N> family;
+  std::vector<std::uint64_t> all(GoldFamily<N>::Size *
+                                 GoldFamily<N>::WordsPerCode);
+  family.generate(all);
+
+  // u and v are m-sequences, with one more one than zero
+  const auto words = GoldFamily<N>::WordsPerCode;
+  REQUIRE(weight(std::span(all).subspan(0, words)) == (1U << (N - 1)));
+  REQUIRE(weight(std::span(all).subspan(words, words)) == (1U << (N - 1)));
+
+  // the cross correlation of a preferred pair takes three values
+  const std::int64_t t = 1 + (std::int64_t{ 1 } << ((N + 2 - N % 2) / 2));
+  REQUIRE(correlations(family, 2) == std::set<std::int64_t>{ -t, -1, t - 2 });
+
+  // the codes are distinct
+  std::set<std::vector<std::uint64_t>> distinct;
+  for (std::uint64_t i = 0; i < GoldFamily<N>::Size; ++i) {
+    distinct.emplace(all.begin() + i * words, all.begin() + (i + 1) * words);
+  }
+  REQUIRE(distinct.size() == GoldFamily<N>::Size);
+}
+
+template<typename Family>
+void
+verify_generator(const Family& family, std::uint64_t i)
+{
+  std::vector<std::uint64_t> code(Family::WordsPerCode);
+  family.code(i, code);
+  auto generator = family.generator(i);
+  for (std::uint64_t chip = 0; chip < Family::Length; ++chip) {
+    REQUIRE(generator.output() == bool((code[chip / 64] >> (chip % 64)) & 1));
+    generator.next();
+  }
+  // and it is periodic
+  REQUIRE(generator.output() == bool(code[0] & 1));
+}
+}
+
+TEST_CASE("gold codes have three valued cross correlation")
+{
+  verify_gold<5>();
+  verify_gold<6>();
+  verify_gold<7>();
+  verify_gold<9>();
+  verify_gold<10>();
+  verify_gold<11>();
+}
+
+TEST_CASE("kasami codes have three valued cross correlation")
+{
+  const KasamiFamily<10> family;
+  REQUIRE(KasamiFamily<10>::Size == 32);
+  const std::int64_t s = 1 << 5;
+  // u against the shifts of w gives two of the values
+  REQUIRE(correlations(family, 1) == std::set<std::int64_t>{ -s - 1, s - 1 });
+
+  // all codes against all shifts of each other give all three, and the
+  // autocorrelation peak of 63 at shift zero
+  REQUIRE(all_correlations(KasamiFamily<6>{}) ==
+          std::set<std::int64_t>{ -9, -1, 7, 63 });
+}
+
+TEST_CASE("gold codes against each other")
+{
+  // t(5) = 9, and the autocorrelation peak of 31 at shift zero
+  REQUIRE(all_correlations(GoldFamily<5>{}) ==
+          std::set<std::int64_t>{ -9, -1, 7, 31 });
+}
+
+TEST_CASE("streamed codes match the bulk ones")
+{
+  const GoldFamily<7> gold;
+  for (std::uint64_t i : { 0, 1, 2, 3, 64, 100, 128 }) {
+    verify_generator(gold, i);
+  }
+  const KasamiFamily<8> kasami;
+  for (std::uint64_t i : { 0, 1, 7, 15 }) {
+    verify_generator(kasami, i);
+  }
+}
@@ -0,0 +1,162 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "tiptap/lfsr_big.h"
+#include "tiptap/statistical_tests.h"
+
+namespace {
+std::vector<std::uint64_t>
+lfsr_output(std::size_t nwords)
+{
+  BigLFSR<64, std::uint64_t> lfsr;
+  std::vector<std::uint64_t> words(nwords);
+  lfsr.generate(std::as_writable_bytes(std::span(words)));
+  return words;
+}
+
+/// splitmix64, as a generator that should pass all the tests
+std::vector<std::uint64_t>
+good_output(std::size_t nwords)
+{
+  std::vector<std::uint64_t> words(nwords);
+  std::uint64_t state = 0;
+  for (auto& w : words) {
+    std::uint64_t z = (state += 0x9e3779b97f4a7c15);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    w = z ^ (z >> 31);
+  }
+  return words;
+}
+
+bool
+same(const std::vector<TestResult>& a, const std::vector<TestResult>& b)
+{
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    if (a[i].name != b[i].name || a[i].p_value != b[i].p_value) {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+TEST_CASE("incomplete gamma function")
+{
+  for (double x : { 0.1, 1.0, 3.0, 10.0, 50.0 }) {
+    REQUIRE(std::abs(detail::igamc(1, x) - std::exp(-x)) < 1e-12);
+    REQUIRE(std::abs(detail::igamc(0.5, x) - std::erfc(std::sqrt(x))) <
+            1e-12);
+  }
+  // a chi-square with many degrees of freedom, at its mean the p-value is
+  // close to one half
+  const double p = detail::igamc(1e6, 1e6);
+  REQUIRE(p > 0.49);
+  REQUIRE(p < 0.51);
+}
+
+TEST_CASE("monobit")
+{
+  MonobitTest balanced;
+  balanced.update(std::vector<std::uint64_t>{ ~std::uint64_t{}, 0 });
+  REQUIRE(balanced.result().p_value == 1.0);
+
+  MonobitTest all_ones;
+  all_ones.update(std::vector<std::uint64_t>(100, ~std::uint64_t{}));
+  REQUIRE(all_ones.result().p_value < 1e-100);
+}
+
+TEST_CASE("runs")
+{
+  // 64 ones followed by 64 zeros has too few runs
+  RunsTest few;
+  few.update(std::vector<std::uint64_t>{ ~std::uint64_t{}, 0 });
+  REQUIRE(few.result().p_value < 1e-10);
+
+  // alternating bits have too many
+  RunsTest many;
+  many.update(std::vector<std::uint64_t>(100, 0x5555555555555555));
+  REQUIRE(many.result().p_value < 1e-100);
+
+  // the transition between words must be counted: 0b01 repeated has a
+  // transition at the word boundary too, so 128 bits give 128 runs.
+  RunsTest boundary;
+  boundary.update(std::vector<std::uint64_t>{ 0xaaaaaaaaaaaaaaaa,
+                                              0xaaaaaaaaaaaaaaaa });
+  const double expected = std::erfc(std::abs(128 - 64.0) /
+                                    (2 * std::sqrt(2 * 128.0) * 0.25));
+  // erfc may be constant folded here but not in the test, which can differ
+  // in the last bit
+  REQUIRE(std::abs(boundary.result().p_value - expected) <= 1e-12 * expected);
+}
+
+TEST_CASE("linear complexity")
+{
+  std::array<std::uint64_t, LinearComplexityTest::words_per_block> block{};
+  REQUIRE(LinearComplexityTest::linear_complexity(block) == 0);
+  block[0] = 1;
+  REQUIRE(LinearComplexityTest::linear_complexity(block) == 1);
+  block[0] = 0;
+  block.back() = std::uint64_t{ 1 } << 63;
+  REQUIRE(LinearComplexityTest::linear_complexity(block) == 512);
+
+  // the output of an lfsr has the complexity of its size
+  const auto words = lfsr_output(block.size());
+  REQUIRE(LinearComplexityTest::linear_complexity(words) == 64);
+  BigLFSR<17, std::uint32_t> lfsr17;
+  lfsr17.generate(std::as_writable_bytes(std::span(block)));
+  REQUIRE(LinearComplexityTest::linear_complexity(block) == 17);
+  BigLFSR<168, std::uint64_t> lfsr168;
+  lfsr168.generate(std::as_writable_bytes(std::span(block)));
+  REQUIRE(LinearComplexityTest::linear_complexity(block) == 168);
+
+  // and the test notices
+  LinearComplexityTest test;
+  test.update(lfsr_output(1 << 14));
+  REQUIRE(test.result().p_value < 1e-100);
+}
+
+TEST_CASE("the result does not depend on the number of threads")
+{
+  const auto words = good_output(1 << 19);
+  TestBattery single(1);
+  single.update(words);
+  TestBattery multi(5);
+  for (std::size_t i = 0; i < words.size(); i += 100'003) {
+    const auto n = std::min<std::size_t>(100'003, words.size() - i);
+    multi.update(std::span(words).subspan(i, n));
+  }
+  REQUIRE(same(single.results(), multi.results()));
+}
+
+TEST_CASE("a good generator passes")
+{
+  TestBattery battery;
+  battery.update(good_output(1 << 20));
+  const auto results = battery.results();
+  REQUIRE(results.size() == 7);
+  for (const auto& r : results) {
+    INFO(r.name);
+    REQUIRE(r.p_value > 1e-4);
+  }
+}
+
+TEST_CASE("feeding in pieces gives the same result as all at once")
+{
+  const auto words = good_output(1000);
+  TestBattery whole;
+  whole.update(words);
+  TestBattery pieces;
+  for (std::size_t i = 0; i < words.size(); i += 37) {
+    const auto n = std::min<std::size_t>(37, words.size() - i);
+    pieces.update(std::span(words).subspan(i, n));
+  }
+  REQUIRE(same(whole.results(), pieces.results()));
+}
@@ -0,0 +1,192 @@
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "tiptap/tausworthe.h"
+
+// the reference implementations, as published by L'Ecuyer with the papers
+// (taus88 in Math. Comp. 65, lfsr113 and lfsr258 in Math. Comp. 68), with the
+// state passed in instead of kept in static variables
+namespace reference {
+std::uint32_t
+taus88(std::uint32_t& s1, std::uint32_t& s2, std::uint32_t& s3)
+{
+  std::uint32_t b;
+  b = (((s1 << 13) ^ s1) >> 19);
+  s1 = (((s1 & 4294967294U) << 12) ^ b);
+  b = (((s2 << 2) ^ s2) >> 25);
+  s2 = (((s2 & 4294967288U) << 4) ^ b);
+  b = (((s3 << 3) ^ s3) >> 11);
+  s3 = (((s3 & 4294967280U) << 17) ^ b);
+  return (s1 ^ s2 ^ s3);
+}
+
+std::uint32_t
+lfsr113(std::uint32_t& z1,
+        std::uint32_t& z2,
+        std::uint32_t& z3,
+        std::uint32_t& z4)
+{
+  std::uint32_t b;
+  b = ((z1 << 6) ^ z1) >> 13;
+  z1 = ((z1 & 4294967294U) << 18) ^ b;
+  b = ((z2 << 2) ^ z2) >> 27;
+  z2 = ((z2 & 4294967288U) << 2) ^ b;
+  b = ((z3 << 13) ^ z3) >> 21;
+  z3 = ((z3 & 4294967280U) << 7) ^ b;
+  b = ((z4 << 3) ^ z4) >> 12;
+  z4 = ((z4 & 4294967168U) << 13) ^ b;
+  return (z1 ^ z2 ^ z3 ^ z4);
+}
+
+std::uint64_t
+lfsr258(std::uint64_t& y1,
+        std::uint64_t& y2,
+        std::uint64_t& y3,
+        std::uint64_t& y4,
+        std::uint64_t& y5)
+{
+  std::uint64_t b;
+  b = ((y1 << 1) ^ y1) >> 53;
+  y1 = ((y1 & 18446744073709551614ULL) << 10) ^ b;
+  b = ((y2 << 24) ^ y2) >> 50;
+  y2 = ((y2 & 18446744073709551104ULL) << 5) ^ b;
+  b = ((y3 << 3) ^ y3) >> 23;
+  y3 = ((y3 & 18446744073709547520ULL) << 29) ^ b;
+  b = ((y4 << 5) ^ y4) >> 24;
+  y4 = ((y4 & 18446744073709420544ULL) << 23) ^ b;
+  b = ((y5 << 3) ^ y5) >> 33;
+  y5 = ((y5 & 18446744073701163008ULL) << 8) ^ b;
+  return (y1 ^ y2 ^ y3 ^ y4 ^ y5);
+}
+}
+
+TEST_CASE("taus88 matches the reference")
+{
+  for (std::uint32_t seed : { 12345U, 16U, 987654321U, 0xffffffffU }) {
+    std::uint32_t s1 = seed, s2 = seed, s3 = seed;
+    Taus88 taus(seed);
+    for (int i = 0; i < 10'000; ++i) {
+      REQUIRE(taus.next() == reference::taus88(s1, s2, s3));
+    }
+  }
+  std::uint32_t s1 = 2, s2 = 8, s3 = 16;
+  Taus88 taus({ 2, 8, 16 });
+  for (int i = 0; i < 10'000; ++i) {
+    REQUIRE(taus() == reference::taus88(s1, s2, s3));
+  }
+}
+
+TEST_CASE("lfsr113 matches the reference")
+{
+  for (std::uint32_t seed : { 12345U, 128U, 987654321U, 0xffffffffU }) {
+    std::uint32_t z1 = seed, z2 = seed, z3 = seed, z4 = seed;
+    Lfsr113 lfsr(seed);
+    for (int i = 0; i < 10'000; ++i) {
+      REQUIRE(lfsr.next() == reference::lfsr113(z1, z2, z3, z4));
+    }
+  }
+}
+
+TEST_CASE("lfsr258 matches the reference")
+{
+  for (std::uint64_t seed : { 123456789123456789ULL, 8388608ULL, ~0ULL }) {
+    std::uint64_t y1 = seed, y2 = seed, y3 = seed, y4 = seed, y5 = seed;
+    Lfsr258 lfsr(seed);
+    for (int i = 0; i < 10'000; ++i) {
+      REQUIRE(lfsr.next() == reference::lfsr258(y1, y2, y3, y4, y5));
+    }
+  }
+}
+
+namespace {
+template<typename Generator>
+bool
+same_state(const Generator& a, const Generator& b)
+{
+  return [&]<std::size_t... I>(std::index_sequence<I...>) {
+    return ((std::get<I>(a.components()).state() ==
+             std::get<I>(b.components()).state()) &&
+            ...);
+  }(std::make_index_sequence<
+           std::tuple_size_v<std::remove_cvref_t<decltype(a.components())>>>{});
+}
+
+template<typename Generator>
+void
+verify_jump()
+{
+  for (std::uint64_t steps : { 0, 1, 2, 5, 63, 64, 100, 1000, 12345 }) {
+    Generator stepped;
+    for (std::uint64_t i = 0; i < steps; ++i) {
+      stepped.next();
+    }
+    Generator jumped;
+    jumped.jump(steps);
+    // all of the state, also the bits below the mask of each component
+    REQUIRE(same_state(jumped, stepped));
+    for (int i = 0; i < 100; ++i) {
+      REQUIRE(jumped.next() == stepped.next());
+    }
+  }
+}
+
+/// jumping a whole period of 2^k-1 calls gives back the same sequence
+template<typename Component>
+void
+verify_period(std::uint64_t seed, std::size_t k)
+{
+  Component a(seed);
+  Component b(seed);
+  b.jump((std::uint64_t{ 1 } << k) - 1);
+  for (int i = 0; i < 100; ++i) {
+    REQUIRE(a.next() == b.next());
+  }
+  // and less than a period does not
+  Component c(seed);
+  c.jump((std::uint64_t{ 1 } << k) - 2);
+  REQUIRE(Component(seed).next() != c.next());
+}
+}
+
+TEST_CASE("tausworthe jump matches stepping")
+{
+  verify_jump<Taus88>();
+  verify_jump<Lfsr113>();
+  verify_jump<Lfsr258>();
+
+  // a jump that does not fit in 64 bits when counted in bits
+  Lfsr258 a;
+  a.jump(~std::uint64_t{});
+  Lfsr258 b;
+  b.jump(~std::uint64_t{} / 2);
+  b.jump(~std::uint64_t{} / 2);
+  b.jump(1);
+  REQUIRE(a.next() == b.next());
+}
+
+TEST_CASE("tausworthe components have full period")
+{
+  verify_period<TauswortheComponent<std::uint32_t, 31, 13, 12>>(12345, 31);
+  verify_period<TauswortheComponent<std::uint32_t, 29, 2, 4>>(12345, 29);
+  verify_period<TauswortheComponent<std::uint32_t, 28, 3, 17>>(12345, 28);
+  verify_period<TauswortheComponent<std::uint64_t, 63, 1, 10>>(12345, 63);
+  verify_period<TauswortheComponent<std::uint64_t, 41, 3, 8>>(1ULL << 40, 41);
+}
+
+TEST_CASE("tausworthe works with the standard library")
+{
+  Lfsr113 lfsr;
+  std::uniform_int_distribution<int> dist(1, 6);
+  for (int i = 0; i < 1000; ++i) {
+    const int x = dist(lfsr);
+    REQUIRE(x >= 1);
+    REQUIRE(x <= 6);
+  }
+  static_assert(std::uniform_random_bit_generator<Taus88>);
+  static_assert(std::uniform_random_bit_generator<Lfsr258>);
+}
@@ -0,0 +1,89 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "tiptap/lfsr.h"
+#include "tiptap/verify_period.h"
+
+template<std::size_t N>
+void
+verify_both()
+{
+  const auto small = verify_period<SmallLFSR<N>>(4);
+  REQUIRE(small.ok());
+  const auto big = verify_period<BigLFSR<N, std::uint64_t>>(4);
+  REQUIRE(big.ok());
+}
+
+TEST_CASE("verify period of small sizes")
+{
+  verify_both<3>();
+  verify_both<4>();
+  verify_both<5>();
+  verify_both<8>();
+  verify_both<13>();
+  verify_both<16>();
+}
+
+TEST_CASE("verify period beyond what the brute force tests cover")
+{
+  verify_both<19>();
+  verify_both<20>();
+  verify_both<21>();
+  verify_both<22>();
+  verify_both<23>();
+  verify_both<24>();
+}
+
+// these take a long time, run with: test_verify_period [exhaustive]
+TEST_CASE("verify period up to N=40", "[.][exhaustive]")
+{
+  verify_both<25>();
+  verify_both<26>();
+  verify_both<27>();
+  verify_both<28>();
+  verify_both<29>();
+  verify_both<30>();
+  verify_both<31>();
+  verify_both<32>();
+  verify_both<33>();
+  verify_both<34>();
+  verify_both<35>();
+  verify_both<36>();
+  verify_both<37>();
+  verify_both<38>();
+  verify_both<39>();
+  verify_both<40>();
+}
+
+namespace {
+/// steps an LFSR three times per step, which gives a shorter period when the
+/// period is divisible by three
+template<typename Inner>
+struct TripleStepper
+{
+  static constexpr std::size_t bitcount() { return Inner::bitcount(); }
+  void next() { m_inner.jump(3); }
+  void jump(std::uint64_t steps) { m_inner.jump(3 * steps); }
+  auto state() const { return m_inner.state(); }
+  Inner m_inner;
+};
+}
+
+TEST_CASE("a too short period is detected")
+{
+  // 2^8-1 = 255 = 3*85
+  const auto report = verify_period<TripleStepper<SmallLFSR<8>>>(2);
+  REQUIRE_FALSE(report.ok());
+  REQUIRE(report.early_returns == 2);
+
+  // 2^7-1 = 127 is prime, so the period is still maximal
+  REQUIRE(verify_period<TripleStepper<SmallLFSR<7>>>(2).ok());
+}
+
+TEST_CASE("verify period of a dense polynomial")
+{
+  // 14 taps, from a primitive polynomial of degree 20
+  using Taps =
+    std::index_sequence<20, 19, 16, 15, 11, 10, 9, 8, 7, 6, 5, 4, 3, 1>;
+  REQUIRE(verify_period<BigLFSR<20, std::uint64_t, true, Taps>>(4).ok());
+  REQUIRE(verify_period<BigLFSR<20, std::uint32_t, false, Taps>>(4).ok());
+}